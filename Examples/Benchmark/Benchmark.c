@@ -0,0 +1,426 @@
+#include <RetrogressiveSystems/RetrogressiveSystems.h>
+
+
+#include <stdio.h>
+#include <string.h>
+
+
+#ifndef SCREEN_WIDTH
+#define SCREEN_WIDTH 256
+#endif
+#ifndef SCREEN_HEIGHT
+#define SCREEN_HEIGHT 224
+#endif
+#ifndef CANVAS_WIDTH
+#define CANVAS_WIDTH 1024
+#endif
+#ifndef CANVAS_HEIGHT
+#define CANVAS_HEIGHT 1024
+#endif
+#ifndef PATTERN_WIDTH
+#define PATTERN_WIDTH 8
+#endif
+#ifndef PATTERN_HEIGHT
+#define PATTERN_HEIGHT 8
+#endif
+#ifndef BITS_PER_PIXEL
+#define BITS_PER_PIXEL 8
+#endif
+#ifndef PREFLIPPED
+#define PREFLIPPED false
+#endif
+#ifndef RETAINED
+#define RETAINED false
+#endif
+#ifndef DRAW_THREADS
+#define DRAW_THREADS 0
+#endif
+#ifndef DEFERRED
+#define DEFERRED false
+#endif
+#ifndef UNPACKED
+#define UNPACKED false
+#endif
+#ifndef FRAME_COUNT
+#define FRAME_COUNT 120
+#endif
+#ifndef SPRITE_COUNT
+#define SPRITE_COUNT 4096
+#endif
+#ifndef UPLOAD_ROUNDS
+#define UPLOAD_ROUNDS 4096
+#endif
+#ifndef PACK_ROUNDS
+#define PACK_ROUNDS 256
+#endif
+#define PATTERN_COUNT 64
+#define BITMAP_SIZE 128
+#define BITMAP_COUNT 8
+#define TILEMAP_WIDTH (CANVAS_WIDTH / PATTERN_WIDTH)
+#define TILEMAP_HEIGHT (CANVAS_HEIGHT / PATTERN_HEIGHT)
+
+
+typedef struct Scenario {
+	const char* name;
+	void(*draw)(int);
+	RGSTime elapsed;
+	RGSDrawStats stats;
+} Scenario;
+
+
+static RGSTile tilemap[TILEMAP_WIDTH * TILEMAP_HEIGHT];
+static RGSTile16 tilemap16[TILEMAP_WIDTH * TILEMAP_HEIGHT];
+static RGSSpriteDesc sprites[SPRITE_COUNT];
+static RGSPalette8 palette;
+static RGSPalette palettes[4];
+static uint8_t upload[PATTERN_COUNT * PATTERN_WIDTH * PATTERN_HEIGHT];
+static uint8_t bitmap_pixels[(BITMAP_SIZE * BITMAP_SIZE * BITS_PER_PIXEL) / 8];
+static RGSBitmap bitmap;
+static RGSTime uploads[4][2];
+static RGSTime pack_loads = 0ULL;
+static RGSTime blend_build = 0ULL;
+static size_t scenario = 0U;
+static Scenario* drawn = RGS_NULL;
+static int frame = 0;
+static bool animated = false;
+static uint8_t check_samples[PATTERN_WIDTH * PATTERN_HEIGHT];
+static int recolour_mismatches = -1;
+
+
+static void DrawTilesOpaque(int in_frame) { RGSDrawTiles(in_frame * 3, in_frame * 2, tilemap, RGS_NULL, false, false, false); };
+
+static void DrawTilesWrapped(int in_frame) { RGSDrawTiles(in_frame * 3, in_frame * 2, tilemap, RGS_NULL, true, true, false); };
+
+static void DrawTilesLayered(int in_frame) {
+	for (int layer_index = 0; layer_index < 4; layer_index++) {
+		RGSDrawTiles(in_frame * (layer_index + 1), in_frame * layer_index, tilemap, (layer_index & 1) ? palettes : RGS_NULL, true, true, layer_index > 0);
+	};
+};
+
+static void DrawTilesBanked(int in_frame) {
+	for (int layer_index = 0; layer_index < 4; layer_index++) {
+		RGSDrawTiles(in_frame * (layer_index + 1), in_frame * layer_index, tilemap, (layer_index & 1) ? RGSGetPaletteBank() : RGS_NULL, true, true, layer_index > 0);
+	};
+};
+
+static void DrawTilesBlended(int in_frame) {
+	for (int layer_index = 0; layer_index < 4; layer_index++) {
+		RGSSelectBlendMode(layer_index > 0 ? RGS_BLEND_HALF : RGS_BLEND_NONE);
+		RGSDrawTiles(in_frame * (layer_index + 1), in_frame * layer_index, tilemap, (layer_index & 1) ? palettes : RGS_NULL, true, true, layer_index > 0);
+	};
+	RGSSelectBlendMode(RGS_BLEND_NONE);
+};
+
+static void DrawTilesAnimated(int in_frame) { DrawTilesLayered(in_frame); };
+
+static void DrawTileMap16Opaque(int in_frame) { RGSDrawTileMap16(in_frame * 3, in_frame * 2, tilemap16, RGS_NULL, false, false, false, RGS_TILE16_ALL); };
+
+static void DrawTileMap16Layered(int in_frame) {
+	for (int layer_index = 0; layer_index < 4; layer_index++) {
+		RGSDrawTileMap16(in_frame * (layer_index + 1), in_frame * layer_index, tilemap16, (layer_index & 1) ? palettes : RGS_NULL, true, true, layer_index > 0, RGS_TILE16_ALL);
+	};
+};
+
+static void PlaceSprites(int in_frame) {
+	uint32_t seed = (uint32_t)(in_frame) + 1U;
+	for (int sprite_index = 0; sprite_index < SPRITE_COUNT; sprite_index++) {
+		RGSSpriteDesc* const sprite = sprites + sprite_index;
+		seed = (seed * 1103515245U) + 12345U;
+		sprite->x = (int)((seed >> 8) % (SCREEN_WIDTH * 2)) - (SCREEN_WIDTH / 2);
+		seed = (seed * 1103515245U) + 12345U;
+		sprite->y = (int)((seed >> 8) % (SCREEN_HEIGHT * 2)) - (SCREEN_HEIGHT / 2);
+		sprite->pattern = (RGSPattern)((seed >> 4) % PATTERN_COUNT);
+		sprite->palette = (sprite_index & 1) ? palette : RGS_NULL;
+		sprite->hflip = (sprite_index & 2) != 0;
+		sprite->vflip = (sprite_index & 4) != 0;
+		sprite->hwrap = false;
+		sprite->vwrap = false;
+	};
+};
+
+static void DrawSprites(int in_frame) {
+	PlaceSprites(in_frame);
+	for (int sprite_index = 0; sprite_index < SPRITE_COUNT; sprite_index++) {
+		const RGSSpriteDesc* const sprite = sprites + sprite_index;
+		RGSDrawSprite(sprite->x, sprite->y, sprite->pattern, sprite->palette, sprite->hflip, sprite->vflip, sprite->hwrap, sprite->vwrap);
+	};
+};
+
+static void DrawSpritesBanked(int in_frame) {
+	PlaceSprites(in_frame);
+	for (int sprite_index = 0; sprite_index < SPRITE_COUNT; sprite_index++) {
+		const RGSSpriteDesc* const sprite = sprites + sprite_index;
+		RGSDrawSprite(sprite->x, sprite->y, sprite->pattern, sprite->palette ? RGSGetBankPalette((uint8_t)(sprite_index & 3)) : RGS_NULL, sprite->hflip, sprite->vflip, sprite->hwrap, sprite->vwrap);
+	};
+};
+
+static void DrawSpritesBlended(int in_frame) {
+	RGSSelectBlendMode(RGS_BLEND_HALF);
+	DrawSprites(in_frame);
+	RGSSelectBlendMode(RGS_BLEND_NONE);
+};
+
+static void DrawSpritesAnimated(int in_frame) { DrawSprites(in_frame); };
+
+static void DrawSpritesBatched(int in_frame) {
+	PlaceSprites(in_frame);
+	RGSDrawSprites(sprites, SPRITE_COUNT, false);
+};
+
+static void DrawSpritesSorted(int in_frame) {
+	PlaceSprites(in_frame);
+	RGSDrawSprites(sprites, SPRITE_COUNT, true);
+};
+
+static void DrawSpritesFew(int in_frame) {
+	PlaceSprites(in_frame);
+	RGSDrawSprites(sprites, 32U, false);
+};
+static void DrawBitmaps(int in_frame) {
+	for (int bitmap_index = 0; bitmap_index < BITMAP_COUNT; bitmap_index++) {
+		RGSDrawBitmap(((in_frame * 3) + (bitmap_index * 37)) % SCREEN_WIDTH - (BITMAP_SIZE / 2), ((in_frame * 2) + (bitmap_index * 29)) % SCREEN_HEIGHT - (BITMAP_SIZE / 2), &bitmap, (bitmap_index & 1) ? palette : RGS_NULL, (bitmap_index & 2) != 0, (bitmap_index & 4) != 0, false, false);
+	};
+};
+
+static void DrawBitmapsBlended(int in_frame) {
+	RGSSelectBlendMode(RGS_BLEND_HALF);
+	DrawBitmaps(in_frame);
+	RGSSelectBlendMode(RGS_BLEND_NONE);
+};
+
+static void DrawBitmapsAsSprites(int in_frame) {
+	for (int bitmap_index = 0; bitmap_index < BITMAP_COUNT; bitmap_index++) {
+		const int bitmap_x = ((in_frame * 3) + (bitmap_index * 37)) % SCREEN_WIDTH - (BITMAP_SIZE / 2);
+		const int bitmap_y = ((in_frame * 2) + (bitmap_index * 29)) % SCREEN_HEIGHT - (BITMAP_SIZE / 2);
+		for (int cell_y = 0; cell_y < BITMAP_SIZE / PATTERN_HEIGHT; cell_y++) {
+			for (int cell_x = 0; cell_x < BITMAP_SIZE / PATTERN_WIDTH; cell_x++) RGSDrawSprite(bitmap_x + (cell_x * PATTERN_WIDTH), bitmap_y + (cell_y * PATTERN_HEIGHT), (RGSPattern)((cell_x + cell_y) % PATTERN_COUNT), (bitmap_index & 1) ? palette : RGS_NULL, (bitmap_index & 2) != 0, (bitmap_index & 4) != 0, false, false);
+		};
+	};
+};
+
+static void DrawPixelsSet(int in_frame) {
+	for (int pixel_y = 0; pixel_y < SCREEN_HEIGHT; pixel_y++) {
+		for (int pixel_x = 0; pixel_x < SCREEN_WIDTH; pixel_x++) RGSSetPixel(pixel_x, pixel_y, (uint8_t)(pixel_x + pixel_y + in_frame));
+	};
+};
+
+static void DrawPixelsLocked(int in_frame) {
+	RGSFramebuffer framebuffer;
+	if (!RGSLockFramebuffer(&framebuffer)) return;
+	const size_t line_size = (((size_t)(framebuffer.width) * framebuffer.bits_per_pixel) + 7U) >> 3;
+	for (uint32_t pixel_y = 0U; pixel_y < framebuffer.height; pixel_y++) {
+		uint8_t* const line_data = framebuffer.pixels + (framebuffer.pitch * pixel_y);
+		for (size_t sample_index = 0U; sample_index < line_size; sample_index++) line_data[sample_index] = (uint8_t)(sample_index + pixel_y + (uint32_t)(in_frame));
+	};
+};
+
+static void DrawFillLocked(int in_frame) {
+	RGSFramebuffer framebuffer;
+	if (RGSLockFramebuffer(&framebuffer)) memset(framebuffer.pixels, in_frame, framebuffer.pitch * framebuffer.height);
+};
+
+static void DrawFillRect(int in_frame) { RGSFillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, (uint8_t)(in_frame)); };
+
+static void DrawShapes(int in_frame) {
+	uint32_t seed = (uint32_t)(in_frame) + 1U;
+	for (int shape_index = 0; shape_index < 256; shape_index++) {
+		seed = (seed * 1103515245U) + 12345U;
+		const int shape_x = (int)((seed >> 8) % (SCREEN_WIDTH + 32)) - 16;
+		seed = (seed * 1103515245U) + 12345U;
+		const int shape_y = (int)((seed >> 8) % (SCREEN_HEIGHT + 32)) - 16;
+		const uint8_t colour_index = (uint8_t)(seed >> 24);
+		switch (shape_index & 3) {
+		case 0:
+			RGSFillRect(shape_x, shape_y, 24, 16, colour_index);
+			break;
+		case 1:
+			RGSDrawRect(shape_x, shape_y, 24, 16, colour_index);
+			break;
+		case 2:
+			RGSDrawLine(shape_x, shape_y, shape_y, shape_x, colour_index);
+			break;
+		case 3:
+			RGSFillCircle(shape_x, shape_y, 12, colour_index);
+			break;
+		};
+	};
+};
+
+
+static void MeasureUploads() {
+	uint32_t seed = 7U;
+	for (size_t sample_index = 0U; sample_index < sizeof(upload); sample_index++) {
+		seed = (seed * 1103515245U) + 12345U;
+		upload[sample_index] = (uint8_t)(seed >> 16);
+	};
+	for (int depth_index = 0; depth_index < 4; depth_index++) {
+		const uint32_t bits = 1U << depth_index;
+		const size_t pattern_size = (PATTERN_WIDTH * PATTERN_HEIGHT * bits) / 8U;
+		RGSTime start_time = RGSTimeNow();
+		for (int round_index = 0; round_index < UPLOAD_ROUNDS; round_index++) {
+			for (int pattern_index = 0; pattern_index < PATTERN_COUNT; pattern_index++) RGSWritePattern((RGSPattern)(pattern_index), bits, upload + (pattern_size * pattern_index));
+		};
+		uploads[depth_index][0] = RGSTimeNow() - start_time;
+		start_time = RGSTimeNow();
+		for (int round_index = 0; round_index < UPLOAD_ROUNDS; round_index++) RGSWritePatterns(0U, PATTERN_COUNT, bits, upload);
+		uploads[depth_index][1] = RGSTimeNow() - start_time;
+	};
+	const RGSAssetDesc pack_desc = { BITS_PER_PIXEL, PATTERN_WIDTH, PATTERN_HEIGHT, PATTERN_COUNT, upload };
+	if (!RGSSaveAssetPack("./Benchmark.rgsp", &pack_desc)) return;
+	const RGSTime start_time = RGSTimeNow();
+	for (int round_index = 0; round_index < PACK_ROUNDS; round_index++) {
+		RGSAssetPack* const pack = RGSOpenAssetPack("./Benchmark.rgsp");
+		RGSUseAssetPatterns(pack);
+		RGSCloseAssetPack(pack);
+	};
+	pack_loads = RGSTimeNow() - start_time;
+	remove("./Benchmark.rgsp");
+};
+
+
+static void CheckRecolouring() {
+	RGSPalette8 recolour;
+	uint8_t expected[2][PATTERN_WIDTH * PATTERN_HEIGHT];
+	RGSFillRect(0, 0, PATTERN_WIDTH * 2, PATTERN_HEIGHT, 0U);
+	for (int draw_index = 0; draw_index < 2; draw_index++) {
+		for (int colour_index = 0; colour_index < 256; colour_index++) recolour[colour_index] = (uint8_t)((colour_index * (draw_index * 2 + 3)) % (1 << BITS_PER_PIXEL));
+		for (int sample_index = 0; sample_index < PATTERN_WIDTH * PATTERN_HEIGHT; sample_index++) expected[draw_index][sample_index] = check_samples[sample_index] ? recolour[check_samples[sample_index]] : 0U;
+		RGSDrawSprite(draw_index * PATTERN_WIDTH, 0, 0U, recolour, false, false, false, false);
+	};
+	recolour_mismatches = 0;
+	for (int draw_index = 0; draw_index < 2; draw_index++) {
+		for (int sample_index = 0; sample_index < PATTERN_WIDTH * PATTERN_HEIGHT; sample_index++) {
+			if (RGSGetPixel((draw_index * PATTERN_WIDTH) + (sample_index % PATTERN_WIDTH), sample_index / PATTERN_WIDTH) != expected[draw_index][sample_index]) recolour_mismatches++;
+		};
+	};
+};
+
+
+static Scenario scenarios[] = {
+	{ "Tiles (opaque)", &DrawTilesOpaque, 0ULL },
+	{ "Tiles (wrapped)", &DrawTilesWrapped, 0ULL },
+	{ "Tiles (4 layers)", &DrawTilesLayered, 0ULL },
+	{ "Tiles (banked, 4 layers)", &DrawTilesBanked, 0ULL },
+	{ "Tiles (blended, 4 layers)", &DrawTilesBlended, 0ULL },
+	{ "Tiles (animated, 4 layers)", &DrawTilesAnimated, 0ULL },
+	{ "Tiles (16-bit)", &DrawTileMap16Opaque, 0ULL },
+	{ "Tiles (16-bit, 4 layers)", &DrawTileMap16Layered, 0ULL },
+	{ "Sprites", &DrawSprites, 0ULL },
+	{ "Sprites (banked)", &DrawSpritesBanked, 0ULL },
+	{ "Sprites (blended)", &DrawSpritesBlended, 0ULL },
+	{ "Sprites (animated)", &DrawSpritesAnimated, 0ULL },
+	{ "Sprites (batched)", &DrawSpritesBatched, 0ULL },
+	{ "Sprites (sorted)", &DrawSpritesSorted, 0ULL },
+	{ "Sprites (32)", &DrawSpritesFew, 0ULL },
+	{ "Bitmaps", &DrawBitmaps, 0ULL },
+	{ "Bitmaps (blended)", &DrawBitmapsBlended, 0ULL },
+	{ "Bitmaps (as sprites)", &DrawBitmapsAsSprites, 0ULL },
+	{ "Pixels (set)", &DrawPixelsSet, 0ULL },
+	{ "Pixels (locked)", &DrawPixelsLocked, 0ULL },
+	{ "Fill (memset)", &DrawFillLocked, 0ULL },
+	{ "Fill (rectangle)", &DrawFillRect, 0ULL },
+	{ "Shapes", &DrawShapes, 0ULL },
+};
+
+
+void RGSConfigure(RGSGameInfo* inout_game, RGSAudioInfo* inout_audio, RGSGraphicsInfo* inout_graphics) {
+	inout_game->name = "Benchmark Example";
+	inout_graphics->screen_width = SCREEN_WIDTH;
+	inout_graphics->screen_height = SCREEN_HEIGHT;
+	inout_graphics->canvas_width = CANVAS_WIDTH;
+	inout_graphics->canvas_height = CANVAS_HEIGHT;
+	inout_graphics->pattern_width = PATTERN_WIDTH;
+	inout_graphics->pattern_height = PATTERN_HEIGHT;
+	inout_graphics->pattern_count = PATTERN_COUNT;
+	inout_graphics->bits_per_pixel = BITS_PER_PIXEL;
+	inout_graphics->preflipped = PREFLIPPED;
+	inout_graphics->retained = RETAINED;
+	inout_graphics->draw_threads = DRAW_THREADS;
+	inout_graphics->deferred = DEFERRED;
+	inout_graphics->unpacked = UNPACKED;
+	inout_graphics->threaded = false;
+};
+
+void RGSBegin() {
+	MeasureUploads();
+	uint8_t pattern[PATTERN_WIDTH * PATTERN_HEIGHT];
+	uint32_t seed = 1U;
+	for (int pattern_index = 0; pattern_index < PATTERN_COUNT; pattern_index++) {
+		for (int sample_index = 0; sample_index < PATTERN_WIDTH * PATTERN_HEIGHT; sample_index++) {
+			seed = (seed * 1103515245U) + 12345U;
+			pattern[sample_index] = ((seed >> 12) % 3U) ? (uint8_t)((seed >> 16) % (1U << BITS_PER_PIXEL)) : 0U;
+		};
+		RGSWritePattern((RGSPattern)(pattern_index), 8U, pattern);
+	};
+	RGSReadPattern(0U, 8U, check_samples);
+	for (size_t sample_index = 0U; sample_index < sizeof(bitmap_pixels); sample_index++) {
+		seed = (seed * 1103515245U) + 12345U;
+		bitmap_pixels[sample_index] = (uint8_t)(seed >> 16);
+	};
+	bitmap.width = BITMAP_SIZE;
+	bitmap.height = BITMAP_SIZE;
+	bitmap.bits_per_pixel = BITS_PER_PIXEL;
+	bitmap.pitch = 0U;
+	bitmap.pixels = bitmap_pixels;
+	bitmap.colour_key = 0U;
+	bitmap.transparent = true;
+	for (int colour_index = 0; colour_index < 256; colour_index++) palette[colour_index] = (uint8_t)((colour_index * 7) % (1 << BITS_PER_PIXEL));
+	for (int palette_index = 0; palette_index < 4; palette_index++) palettes[palette_index] = palette;
+	RGSWritePaletteBank(0U, 4U, palettes);
+	const RGSTime blend_start = RGSTimeNow();
+	RGSSelectBlendMode(RGS_BLEND_HALF);
+	blend_build = RGSTimeNow() - blend_start;
+	RGSSelectBlendMode(RGS_BLEND_NONE);
+	for (int tile_index = 0; tile_index < TILEMAP_WIDTH * TILEMAP_HEIGHT; tile_index++) {
+		tilemap[tile_index].pattern = (RGSPattern)(tile_index % PATTERN_COUNT);
+		tilemap[tile_index].palette = (uint8_t)(tile_index % 4);
+		tilemap[tile_index].hflip = (tile_index / 3) % 2;
+		tilemap[tile_index].vflip = (tile_index / 5) % 2;
+		tilemap16[tile_index] = RGS_TILE16_MAKE(tilemap[tile_index].pattern, tilemap[tile_index].palette, tilemap[tile_index].hflip, tilemap[tile_index].vflip, false);
+	};
+};
+
+void RGSEnd() {
+	printf("Screen %dx%d, canvas %dx%d, patterns %dx%d, %d bits per pixel, %d drawing threads, %s drawing\n", SCREEN_WIDTH, SCREEN_HEIGHT, CANVAS_WIDTH, CANVAS_HEIGHT, PATTERN_WIDTH, PATTERN_HEIGHT, BITS_PER_PIXEL, DRAW_THREADS, DEFERRED ? "deferred" : "immediate");
+	for (size_t scenario_index = 0U; scenario_index < scenario; scenario_index++) {
+		const double frame_time = (double)(scenarios[scenario_index].elapsed) / (double)(FRAME_COUNT);
+		const RGSDrawStats* const stats = &scenarios[scenario_index].stats;
+		printf("%-24s %10.2f us/frame %8.3f ns/screen pixel %6u commands %6u merged %6u skipped\n", scenarios[scenario_index].name, frame_time, (frame_time * 1000.0) / (double)(SCREEN_WIDTH * SCREEN_HEIGHT), stats->commands, stats->merged, stats->skipped);
+	};
+	for (int depth_index = 0; depth_index < 4; depth_index++) {
+		const double pattern_total = (double)(UPLOAD_ROUNDS * PATTERN_COUNT) * (double)(RGS_ONE_SECOND);
+		printf("Patterns from %d bits %14.0f patterns/s single %14.0f patterns/s bulk\n", 1 << depth_index, pattern_total / (double)(uploads[depth_index][0] ? uploads[depth_index][0] : 1ULL), pattern_total / (double)(uploads[depth_index][1] ? uploads[depth_index][1] : 1ULL));
+	};
+	printf("Patterns from a pack %10.2f us to open, use and close %d patterns\n", (double)(pack_loads) / (double)(PACK_ROUNDS), PATTERN_COUNT);
+	printf("Blend table         %10.2f us to build for %d colours\n", (double)(blend_build), 1 << BITS_PER_PIXEL);
+	printf("Recoloured palettes  %s (%d pixels differ from immediate drawing)\n", recolour_mismatches ? "MISMATCH" : "match", recolour_mismatches);
+};
+
+void RGSUpdate(RGSTime in_elapsed) {
+	const bool animating = scenario < sizeof(scenarios) / sizeof(*scenarios) && (scenarios[scenario].draw == &DrawTilesAnimated || scenarios[scenario].draw == &DrawSpritesAnimated);
+	if (animating == animated) return;
+	animated = animating;
+	for (int pattern_index = 0; pattern_index < PATTERN_COUNT; pattern_index++) {
+		RGSPattern frames[4];
+		for (int frame_index = 0; frame_index < 4; frame_index++) frames[frame_index] = (RGSPattern)((pattern_index + frame_index) % PATTERN_COUNT);
+		RGSSetPatternAnimation((RGSPattern)(pattern_index), animated ? frames : RGS_NULL, 4U, RGS_ONE_SECOND / 60U);
+	};
+};
+
+void RGSRender() {
+	if (drawn) RGSReadDrawStats(&drawn->stats);
+	if (scenario >= sizeof(scenarios) / sizeof(*scenarios)) {
+		RGSQuit();
+		return;
+	};
+	if (recolour_mismatches < 0) CheckRecolouring();
+	const RGSTime start_time = RGSTimeNow();
+	scenarios[scenario].draw(frame);
+	RGSGetPixel(0, 0);
+	scenarios[scenario].elapsed += RGSTimeNow() - start_time;
+	drawn = scenarios + scenario;
+	if (++frame >= FRAME_COUNT) {
+		frame = 0;
+		scenario++;
+	};
+};
@@ -0,0 +1,84 @@
+#pragma once
+#ifndef RETROGRESSIVESYSTEMS_ASSETS_H
+#define RETROGRESSIVESYSTEMS_ASSETS_H
+
+
+#include <RetrogressiveSystems/Graphics.h>
+
+
+#define RGS_ASSET_VERSION															1U										// Asset Pack Format Version
+
+
+typedef struct RGSAssetPack RGSAssetPack;																					// Mapped Asset Pack Type
+
+
+/// @brief Tile Map Description Container
+typedef struct RGSTileMapDesc {
+	uint32_t width;																											// Width In Tiles
+	uint32_t height;																										// Height In Tiles
+	const RGSTile* tiles;																									// Tile Pointer (Row by row, hflip and vflip must be 0 or 1)
+} RGSTileMapDesc;
+
+
+/// @brief Asset Pack Description Container
+typedef struct RGSAssetDesc {
+	uint32_t bits_per_pixel;																								// Pattern Bits Per Pixel (Must be 1, 2, 4 or 8)
+	uint32_t pattern_width;																									// Pattern Width In Pixels (Must be 8, 16 or 32)
+	uint32_t pattern_height;																								// Pattern Height In Pixels (Must be 8, 16 or 32)
+	uint32_t pattern_count;																									// Pattern Count
+	const uint8_t* patterns;																								// Pattern Pointer (Packed the same way as RGSWritePattern expects)
+	uint32_t colour_count;																									// Colour Count
+	const RGSColour* colours;																								// Colour Pointer
+	uint32_t palette_count;																									// Palette Count
+	const RGSPalette8* palettes;																							// Palette Pointer
+	uint32_t tilemap_count;																									// Tile Map Count
+	const RGSTileMapDesc* tilemaps;																							// Tile Map Pointer (Left empty when reading a pack, use RGSReadAssetTileMap)
+} RGSAssetDesc;
+
+
+/// @brief Writes the given assets to a pack file (Save it with the game's bits per pixel and pattern size so it can be used without converting)
+/// @param in_path
+/// @param in_desc
+/// @return Successfully written?
+RGS_EXTERN bool RGSSaveAssetPack(const char* in_path, const RGSAssetDesc* in_desc);
+
+/// @brief Maps a pack file into memory without reading or copying it (Pages are loaded the first time they are used)
+/// @param in_path
+/// @return Pack pointer or null on failure
+RGS_EXTERN RGSAssetPack* RGSOpenAssetPack(const char* in_path);
+
+/// @brief Unmaps a pack file once recorded drawing has been replayed (Patterns read straight from the pack are copied out first, only call from RGSBegin, RGSUpdate or RGSEnd)
+/// @param inout_pack
+RGS_EXTERN void RGSCloseAssetPack(RGSAssetPack* inout_pack);
+
+
+/// @brief Acquires the pack's layout and pointers into the mapped file
+/// @param in_pack
+/// @param out_desc
+RGS_EXTERN void RGSReadAssetDesc(const RGSAssetPack* in_pack, RGSAssetDesc* out_desc);
+
+/// @brief Acquires the specified tile map inside the mapped file
+/// @param in_pack
+/// @param in_index
+/// @param out_tilemap
+/// @return Tile map exists?
+RGS_EXTERN bool RGSReadAssetTileMap(const RGSAssetPack* in_pack, uint32_t in_index, RGSTileMapDesc* out_tilemap);
+
+/// @brief Acquires the specified palette inside the mapped file
+/// @param in_pack
+/// @param in_index
+/// @return Palette pointer or null if it doesn't exist
+RGS_EXTERN RGSPalette RGSReadAssetPalette(const RGSAssetPack* in_pack, uint32_t in_index);
+
+
+/// @brief Uses the pack's patterns (Read straight from the mapped file when bits, pattern size and count match and patterns aren't preflipped, otherwise written)
+/// @param inout_pack
+/// @return Successfully used?
+RGS_EXTERN bool RGSUseAssetPatterns(RGSAssetPack* inout_pack);
+
+/// @brief Writes the pack's colours into the palette
+/// @param in_pack
+RGS_EXTERN void RGSUseAssetColours(const RGSAssetPack* in_pack);
+
+
+#endif
@@ -4,9 +4,13 @@
 
 
 #define RGS_OS_WINDOWS																0x00010000								// Windows Operating System
+#define RGS_OS_LINUX																0x00020000								// Linux Operating System
 
 #define RGS_DEVICE_COMPUTER															0										// Computer Device Type
 
+#define RGS_ARCH_OTHER																0										// Other Processor Architecture
+#define RGS_ARCH_X64																1										// x86-64 Processor Architecture
+
 #define RGS_BUILD_DEBUG																0										// Debug Build Mode
 #define RGS_BUILD_RELEASE															1										// Release Build Mode
 
@@ -17,10 +21,19 @@
 #if defined(_WIN32)
 #define RGS_OS																		RGS_OS_WINDOWS							// Target Operating System (Windows)
 #define RGS_DEVICE																	RGS_DEVICE_COMPUTER						// Target Device Type (Computer)
+#elif defined(__linux__)
+#define RGS_OS																		RGS_OS_LINUX							// Target Operating System (Linux)
+#define RGS_DEVICE																	RGS_DEVICE_COMPUTER						// Target Device Type (Computer)
 #else
 #error Unsupported operating system
 #endif
 
+#if defined(_M_X64) || defined(__x86_64__)
+#define RGS_ARCH																	RGS_ARCH_X64							// Target Processor Architecture (x86-64)
+#else
+#define RGS_ARCH																	RGS_ARCH_OTHER							// Target Processor Architecture (Other)
+#endif
+
 #ifdef _DEBUG
 #define RGS_BUILD																	RGS_BUILD_DEBUG							// Active Build Mode (Debug)
 #else
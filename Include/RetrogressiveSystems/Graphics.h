@@ -12,7 +12,11 @@ typedef uint8_t RGSPalette1[1U << 1U];																						// 1-Bit Colour Pale
 typedef uint8_t RGSPalette2[1U << 2U];																						// 2-Bit Colour Palette Type
 typedef uint8_t RGSPalette4[1U << 4U];																						// 4-Bit Colour Palette Type
 typedef uint8_t RGSPalette8[1U << 8U];																						// 8-Bit Colour Palette Type
+typedef const RGSPalette* RGSPaletteBank;																					// Palette Bank Type (Usable wherever a palette array is)
 typedef uint8_t RGSPattern;																									// Pattern Index Type
+typedef uint8_t RGSPatternBank;																								// Pattern Bank Index Type
+typedef uint8_t RGSBlendMode;																								// Blend Mode Type
+typedef uint16_t RGSTile16;																									// Packed Tile Type (Pattern in bits 0-7, palette in bits 8-11, flips in bits 12-13 and priority in bit 14)
 
 
 /// @brief Makes a colour from the supplied red, green & blue
@@ -37,6 +41,53 @@ typedef uint8_t RGSPattern;																									// Pattern Index Type
 /// @return Blue value
 #define RGS_COLOUR_BLUE(_COLOUR) ((RGSColour)(_COLOUR) & 0xFFU)
 
+/// @brief Makes a packed tile from the supplied pattern, palette, flips & priority
+/// @param _PATTERN
+/// @param _PALETTE
+/// @param _HFLIP
+/// @param _VFLIP
+/// @param _PRIORITY
+/// @return Packed tile
+#define RGS_TILE16_MAKE(_PATTERN, _PALETTE, _HFLIP, _VFLIP, _PRIORITY) ((RGSTile16)(((RGSTile16)(_PATTERN) & 0xFFU) | (((RGSTile16)(_PALETTE) & 0xFU) << 8U) | ((_HFLIP) ? 0x1000U : 0U) | ((_VFLIP) ? 0x2000U : 0U) | ((_PRIORITY) ? 0x4000U : 0U)))
+
+/// @brief Acquires the given packed tile's pattern index
+/// @param _TILE
+/// @return Pattern index
+#define RGS_TILE16_PATTERN(_TILE) ((RGSPattern)((RGSTile16)(_TILE) & 0xFFU))
+
+/// @brief Acquires the given packed tile's palette index
+/// @param _TILE
+/// @return Palette index
+#define RGS_TILE16_PALETTE(_TILE) ((uint8_t)(((RGSTile16)(_TILE) >> 8U) & 0xFU))
+
+/// @brief Acquires the given packed tile's horizontal flip
+/// @param _TILE
+/// @return Horizontally flipped?
+#define RGS_TILE16_HFLIP(_TILE) (((RGSTile16)(_TILE) & 0x1000U) != 0U)
+
+/// @brief Acquires the given packed tile's vertical flip
+/// @param _TILE
+/// @return Vertically flipped?
+#define RGS_TILE16_VFLIP(_TILE) (((RGSTile16)(_TILE) & 0x2000U) != 0U)
+
+/// @brief Acquires the given packed tile's priority
+/// @param _TILE
+/// @return High priority?
+#define RGS_TILE16_PRIORITY(_TILE) (((RGSTile16)(_TILE) & 0x4000U) != 0U)
+
+#define RGS_TILE16_LOW																0x1U									// Draws Packed Tiles Without Priority
+#define RGS_TILE16_HIGH																0x2U									// Draws Packed Tiles With Priority
+#define RGS_TILE16_ALL																0x3U									// Draws Every Packed Tile
+
+#define RGS_BLEND_NONE																0U										// Draws Colours Over The Screen
+#define RGS_BLEND_HALF																1U										// Averages Colours With The Screen
+#define RGS_BLEND_ADD																2U										// Adds Colours To The Screen
+#define RGS_BLEND_SUBTRACT															3U										// Subtracts Colours From The Screen
+#define RGS_BLEND_MULTIPLY															4U										// Multiplies The Screen By Colours
+#define RGS_BLEND_SHADOW															5U										// Halves The Screen's Brightness Wherever Colours Are Drawn
+
+#define RGS_COLOUR_CYCLE_LIMIT														8U										// Maximum Colour Cycles Running At Once
+
 
 /// @brief Tile Container
 typedef struct RGSTile {
@@ -47,6 +98,31 @@ typedef struct RGSTile {
 } RGSTile;
 
 
+/// @brief Sprite Description Container
+typedef struct RGSSpriteDesc {
+	int x;																													// Horizontal Position In Pixels
+	int y;																													// Vertical Position In Pixels
+	RGSPattern pattern;																										// Pattern Index
+	RGSPalette palette;																										// Palette Pointer (Optional)
+	bool hflip;																												// Horizontal Flip
+	bool vflip;																												// Vertical Flip
+	bool hwrap;																												// Horizontal Wrap
+	bool vwrap;																												// Vertical Wrap
+} RGSSpriteDesc;
+
+
+/// @brief Bitmap Container
+typedef struct RGSBitmap {
+	uint32_t width;																											// Width In Pixels
+	uint32_t height;																										// Height In Pixels
+	uint32_t bits_per_pixel;																								// Bits Per Pixel (Must be 1, 2, 4 or 8)
+	uint32_t pitch;																											// Bytes Between Rows (0 means each row starts on the byte after the last one ends)
+	const uint8_t* pixels;																									// Pixel Pointer (Packed the same way as RGSReadPixels, leftmost pixel in the highest bits)
+	uint8_t colour_key;																										// Transparent Colour Index (Compared before the palette is applied)
+	bool transparent;																										// Skip Pixels Matching The Colour Key?
+} RGSBitmap;
+
+
 /// @brief Graphics Info Container
 typedef struct RGSGraphicsInfo {
 #if RGS_DEVICE == RGS_DEVICE_COMPUTER
@@ -65,9 +141,39 @@ typedef struct RGSGraphicsInfo {
 	uint32_t bits_per_pixel;																								// Target Bits Per Pixel (Must be 1, 2, 4 or 8)
 	uint32_t frame_rate;																									// Target Frame Rate (Must be between 1 and 60)
 	bool threaded;																											// Try To Use A Separate Thread?
+	bool preflipped;																										// Store Flipped Copies Of Patterns? (Uses 4x the pattern memory but skips flipping while drawing)
+	bool retained;																											// Track Changed Cells? (Only clears and presents the parts of the screen that were drawn to)
+	uint32_t draw_threads;																									// Drawing Thread Count (Above 1 records tile layers and sprites and draws them in horizontal bands once rendering ends)
+	bool deferred;																											// Record Drawing And Replay It After Rendering? (Copies tiles, sprites and palettes so the game can update while a frame is drawn)
+	bool unpacked;																											// Draw Low Bit Depths A Byte Per Pixel? (Uses up to 8x the pixel memory but draws with the 8 bits per pixel kernels and packs when presenting)
+	uint32_t pattern_banks;																									// Resident Pattern Bank Count (Each holds pattern count patterns, 0 is treated as 1, must be less than or equal to 256)
 } RGSGraphicsInfo;
 
 
+/// @brief Draw Statistics Container
+typedef struct RGSDrawStats {
+	uint32_t commands;																										// Commands Replayed
+	uint32_t sprites;																										// Sprites Recorded
+	uint32_t layers;																										// Tile Layers Recorded (Including packed tile layers)
+	uint32_t pixels;																										// Pixels Recorded
+	uint32_t bitmaps;																										// Bitmaps Recorded
+	uint32_t shapes;																										// Spans, Rectangles, Lines And Circles Recorded
+	uint32_t merged;																										// Sprite Draws Merged Into The Previous Command
+	uint32_t skipped;																										// Commands Skipped Because A Later One Covered The Screen
+	uint32_t bytes;																											// Arena Bytes Used For Copies
+} RGSDrawStats;
+
+
+/// @brief Framebuffer Container
+typedef struct RGSFramebuffer {
+	uint8_t* pixels;																										// Pixel Pointer (Rows are packed the same way as RGSReadPixels, leftmost pixel in the highest bits)
+	size_t pitch;																											// Bytes Between Rows
+	uint32_t width;																											// Width In Pixels
+	uint32_t height;																										// Height In Pixels
+	uint32_t bits_per_pixel;																								// Bits Per Pixel (1, 2, 4 or 8, always 8 when drawing unpacked where only the low bits of each byte are shown)
+} RGSFramebuffer;
+
+
 /// @brief Acquires the specified colour in the palette
 /// @param in_index 
 /// @return Packed colour
@@ -86,19 +192,105 @@ RGS_EXTERN void RGSReadColours(RGSColour* out_data);
 /// @param in_data 
 RGS_EXTERN void RGSWriteColours(const RGSColour* in_data);
 
+/// @brief Rotates a range of colours by one entry every period on screen without changing the palette (Cycle must be lower than RGS_COLOUR_CYCLE_LIMIT, fewer than two colours or no period stops it)
+/// @param in_cycle 
+/// @param in_first 
+/// @param in_count 
+/// @param in_period 
+/// @param in_reverse 
+RGS_EXTERN void RGSCycleColours(uint8_t in_cycle, uint8_t in_first, uint32_t in_count, RGSTime in_period, bool in_reverse);
+
+/// @brief Fades the colours on screen towards the given colour over the duration without changing the palette (Level 255 reaches the colour and 0 fades back to the palette)
+/// @param in_colour 
+/// @param in_level 
+/// @param in_duration 
+RGS_EXTERN void RGSFadeColours(RGSColour in_colour, uint8_t in_level, RGSTime in_duration);
+
+/// @brief Flashes the colours on screen towards the given colour without changing the palette (Rises over the attack, holds, then falls over the release)
+/// @param in_colour 
+/// @param in_attack 
+/// @param in_hold 
+/// @param in_release 
+RGS_EXTERN void RGSFlashColours(RGSColour in_colour, RGSTime in_attack, RGSTime in_hold, RGSTime in_release);
+
+/// @brief Stops every colour cycle, fade and flash
+RGS_EXTERN void RGSClearColourEffects();
+
 
-/// @brief Acquires the specified pattern on the texture (Index must be lower than pattern count and bits must be 1, 2, 4 or 8)
+/// @brief Acquires the specified pattern in the selected bank (Index must be lower than pattern count and bits must be 1, 2, 4 or 8)
 /// @param in_index 
 /// @param in_bits 
 /// @param out_data 
 RGS_EXTERN void RGSReadPattern(RGSPattern in_index, uint32_t in_bits, uint8_t* out_data);
 
-/// @brief Updates the specified pattern on the texture (Index must be lower than pattern count and bits must be 1, 2, 4 or 8)
+/// @brief Updates the specified pattern in the selected bank (Index must be lower than pattern count and bits must be 1, 2, 4 or 8)
 /// @param in_index 
 /// @param in_bits 
 /// @param in_data 
 RGS_EXTERN void RGSWritePattern(RGSPattern in_index, uint32_t in_bits, const uint8_t* in_data);
 
+/// @brief Updates a run of consecutive patterns in the selected bank from one buffer (Converts them all in one pass, bits must be 1, 2, 4 or 8)
+/// @param in_first 
+/// @param in_count 
+/// @param in_bits 
+/// @param in_data 
+RGS_EXTERN void RGSWritePatterns(RGSPattern in_first, uint32_t in_count, uint32_t in_bits, const uint8_t* in_data);
+
+
+/// @brief Selects the pattern bank that later draws, reads and writes use (Switching doesn't copy anything, so it can change per tile layer or per sprite)
+/// @param in_bank 
+RGS_EXTERN void RGSSelectPatternBank(RGSPatternBank in_bank);
+
+/// @brief Acquires the selected pattern bank
+/// @return Bank index
+RGS_EXTERN RGSPatternBank RGSGetPatternBank();
+
+/// @brief Converts patterns into a spare copy of the specified bank and swaps it in when the next frame starts (Can be called from any thread, fails while the bank's last load is still waiting)
+/// @param in_bank 
+/// @param in_count 
+/// @param in_bits 
+/// @param in_data 
+/// @return Load accepted?
+RGS_EXTERN bool RGSLoadPatternBank(RGSPatternBank in_bank, uint32_t in_count, uint32_t in_bits, const uint8_t* in_data);
+
+/// @brief Checks to see if the specified bank's last load has been swapped in
+/// @param in_bank 
+/// @return Bank loaded?
+RGS_EXTERN bool RGSPatternBankLoaded(RGSPatternBank in_bank);
+
+/// @brief Animates the specified pattern so tiles and sprites drawing it show each frame in turn for the frame time (Fewer than two frames or no frame time stops it, reading and writing patterns is unaffected)
+/// @param in_base 
+/// @param in_frames 
+/// @param in_count 
+/// @param in_frame_time 
+RGS_EXTERN void RGSSetPatternAnimation(RGSPattern in_base, const RGSPattern* in_frames, uint32_t in_count, RGSTime in_frame_time);
+
+
+/// @brief Copies palettes into the graphics system's palette bank (Each palette needs an entry per colour, later draws using the bank see the new entries)
+/// @param in_first 
+/// @param in_count 
+/// @param in_palettes 
+/// @return Successfully written?
+RGS_EXTERN bool RGSWritePaletteBank(uint8_t in_first, uint32_t in_count, const RGSPalette* in_palettes);
+
+/// @brief Acquires the palette bank for tile draws (256 palettes kept in one aligned block, unwritten palettes leave colours unchanged)
+/// @return Palette bank or null if it couldn't be allocated
+RGS_EXTERN RGSPaletteBank RGSGetPaletteBank();
+
+/// @brief Acquires the specified palette in the palette bank for sprite and bitmap draws
+/// @param in_index 
+/// @return Palette pointer or null if the bank couldn't be allocated
+RGS_EXTERN RGSPalette RGSGetBankPalette(uint8_t in_index);
+
+
+/// @brief Selects the blend mode that later sprite, tile and bitmap draws use (Looks up a table built from the colour palette, which is rebuilt when the palette changes)
+/// @param in_mode 
+RGS_EXTERN void RGSSelectBlendMode(RGSBlendMode in_mode);
+
+/// @brief Acquires the selected blend mode
+/// @return Blend mode
+RGS_EXTERN RGSBlendMode RGSGetBlendMode();
+
 
 /// @brief Acquires the specified pixel colour on the virtual screen
 /// @param in_x 
@@ -120,6 +312,27 @@ RGS_EXTERN void RGSReadPixels(uint8_t* out_pixels);
 /// @param in_pixels 
 RGS_EXTERN void RGSWritePixels(const uint8_t* in_pixels);
 
+/// @brief Reads the pixels inside a rectangle on screen (Rectangle must be on screen, each row starts on a new byte)
+/// @param in_x 
+/// @param in_y 
+/// @param in_width 
+/// @param in_height 
+/// @param out_pixels 
+RGS_EXTERN void RGSReadPixelsRect(int in_x, int in_y, int in_width, int in_height, uint8_t* out_pixels);
+
+/// @brief Writes the pixels inside a rectangle on screen (Rectangle must be on screen, each row starts on a new byte)
+/// @param in_x 
+/// @param in_y 
+/// @param in_width 
+/// @param in_height 
+/// @param in_pixels 
+RGS_EXTERN void RGSWritePixelsRect(int in_x, int in_y, int in_width, int in_height, const uint8_t* in_pixels);
+
+/// @brief Acquires the virtual screen's pixels for writing directly (Draws everything recorded so far, the pointer is only valid until RGSRender returns)
+/// @param out_framebuffer 
+/// @return Framebuffer acquired?
+RGS_EXTERN bool RGSLockFramebuffer(RGSFramebuffer* out_framebuffer);
+
 
 /// @brief Draws a sprite to the virtual screen (Pattern index must be lower than pattern count)
 /// @param in_x 
@@ -132,6 +345,12 @@ RGS_EXTERN void RGSWritePixels(const uint8_t* in_pixels);
 /// @param in_vwrap 
 RGS_EXTERN void RGSDrawSprite(int in_x, int in_y, RGSPattern in_pattern, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap);
 
+/// @brief Draws the given sprites to the virtual screen in order (Sorting only reorders sprites that can't overlap)
+/// @param in_sprites 
+/// @param in_count 
+/// @param in_sort 
+RGS_EXTERN void RGSDrawSprites(const RGSSpriteDesc* in_sprites, size_t in_count, bool in_sort);
+
 /// @brief Draws the given tiles to the virtual screen (Tile array must fill canvas)
 /// @param in_x 
 /// @param in_y 
@@ -142,6 +361,72 @@ RGS_EXTERN void RGSDrawSprite(int in_x, int in_y, RGSPattern in_pattern, RGSPale
 /// @param in_transparent 
 RGS_EXTERN void RGSDrawTiles(int in_x, int in_y, const RGSTile* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent);
 
+/// @brief Draws the given packed tiles to the virtual screen (Tile array must fill canvas, only tiles matching the priorities are drawn)
+/// @param in_x 
+/// @param in_y 
+/// @param in_tiles 
+/// @param in_palettes 
+/// @param in_hwrap 
+/// @param in_vwrap 
+/// @param in_transparent 
+/// @param in_priorities 
+RGS_EXTERN void RGSDrawTileMap16(int in_x, int in_y, const RGSTile16* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent, uint32_t in_priorities);
+
+/// @brief Draws a bitmap of any size to the virtual screen (The palette needs an entry per bitmap colour, wrapping needs the bitmap to fit the canvas, pixels are read when the frame is drawn)
+/// @param in_x 
+/// @param in_y 
+/// @param in_bitmap 
+/// @param in_palette 
+/// @param in_hflip 
+/// @param in_vflip 
+/// @param in_hwrap 
+/// @param in_vwrap 
+RGS_EXTERN void RGSDrawBitmap(int in_x, int in_y, const RGSBitmap* in_bitmap, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap);
+
+
+/// @brief Fills a horizontal run of pixels on the virtual screen (Clipped to the screen)
+/// @param in_x 
+/// @param in_y 
+/// @param in_width 
+/// @param in_index 
+RGS_EXTERN void RGSFillSpan(int in_x, int in_y, int in_width, uint8_t in_index);
+
+/// @brief Fills a rectangle on the virtual screen (Clipped to the screen)
+/// @param in_x 
+/// @param in_y 
+/// @param in_width 
+/// @param in_height 
+/// @param in_index 
+RGS_EXTERN void RGSFillRect(int in_x, int in_y, int in_width, int in_height, uint8_t in_index);
+
+/// @brief Draws a one pixel wide rectangle outline on the virtual screen (Clipped to the screen)
+/// @param in_x 
+/// @param in_y 
+/// @param in_width 
+/// @param in_height 
+/// @param in_index 
+RGS_EXTERN void RGSDrawRect(int in_x, int in_y, int in_width, int in_height, uint8_t in_index);
+
+/// @brief Draws a line between two points on the virtual screen, both included (Clipped to the screen)
+/// @param in_start_x 
+/// @param in_start_y 
+/// @param in_end_x 
+/// @param in_end_y 
+/// @param in_index 
+RGS_EXTERN void RGSDrawLine(int in_start_x, int in_start_y, int in_end_x, int in_end_y, uint8_t in_index);
+
+/// @brief Fills a circle on the virtual screen (Clipped to the screen, a radius of 0 fills one pixel)
+/// @param in_x 
+/// @param in_y 
+/// @param in_radius 
+/// @param in_index 
+RGS_EXTERN void RGSFillCircle(int in_x, int in_y, int in_radius, uint8_t in_index);
+
+
+/// @brief Reads the recorded draw statistics of the previous frame (Only counts drawing recorded for drawing threads or deferred drawing)
+/// @param out_stats 
+RGS_EXTERN void RGSReadDrawStats(RGSDrawStats* out_stats);
+
 
 #endif
 
@@ -9,6 +9,7 @@
 #include <RetrogressiveSystems/Input.h>
 #include <RetrogressiveSystems/Audio.h>
 #include <RetrogressiveSystems/Graphics.h>
+#include <RetrogressiveSystems/Assets.h>
 #include <RetrogressiveSystems/Game.h>
 
 
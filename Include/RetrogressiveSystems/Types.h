@@ -8,8 +8,10 @@
 
 #if RGS_LANGUAGE == RGS_LANGUAGE_C
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #else
+#include <cstddef>
 #include <cstdint>
 #endif
 
@@ -0,0 +1,329 @@
+#include <RetrogressiveSystems/Assets.h>
+
+
+#include <RetrogressiveSystems/Output.h>
+
+#include "./Graphics.inl"
+
+#if RGS_OS == RGS_OS_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error Asset packs are little-endian and mapped without conversion, so big-endian targets are unsupported
+#endif
+
+#define RGS_ASSET_MAGIC 0x50534752U
+#define RGS_ASSET_ALIGNMENT 64U
+
+
+/// Internal Asset Types
+
+typedef struct RGSAssetHeader {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t header_size;
+	uint8_t bits_per_pixel;
+	uint8_t pattern_width;
+	uint8_t pattern_height;
+	uint8_t reserved;
+	uint32_t pattern_count;
+	uint32_t pattern_offset;
+	uint32_t colour_count;
+	uint32_t colour_offset;
+	uint32_t palette_count;
+	uint32_t palette_offset;
+	uint32_t tilemap_count;
+	uint32_t tilemap_offset;
+} RGSAssetHeader;
+
+typedef struct RGSAssetTileMap {
+	uint32_t width;
+	uint32_t height;
+	uint32_t offset;
+} RGSAssetTileMap;
+
+#if RGS_OS == RGS_OS_WINDOWS
+typedef HANDLE RGSAssetFile;
+#elif RGS_OS == RGS_OS_LINUX
+typedef FILE* RGSAssetFile;
+#endif
+
+struct RGSAssetPack {
+	uint8_t* data;
+	size_t size;
+	const RGSAssetHeader* header;
+#if RGS_OS == RGS_OS_WINDOWS
+	HANDLE file;
+	HANDLE mapping;
+#endif
+};
+
+
+/// Internal Asset Functions
+
+static RGS_INLINE uint64_t RGSAlignAsset(uint64_t in_offset) { return (in_offset + (RGS_ASSET_ALIGNMENT - 1U)) & ~(uint64_t)(RGS_ASSET_ALIGNMENT - 1U); };
+
+static RGS_INLINE uint64_t RGSAssetPatternSize(const RGSAssetHeader* in_header) { return ((uint64_t)(in_header->pattern_width) * in_header->pattern_height * in_header->bits_per_pixel) >> 3; };
+
+static RGS_INLINE bool RGSValidAssetFormat(const RGSAssetHeader* in_header) {
+	return (in_header->bits_per_pixel == 1U || in_header->bits_per_pixel == 2U || in_header->bits_per_pixel == 4U || in_header->bits_per_pixel == 8U) &&
+		(in_header->pattern_width == 8U || in_header->pattern_width == 16U || in_header->pattern_width == 32U) &&
+		(in_header->pattern_height == 8U || in_header->pattern_height == 16U || in_header->pattern_height == 32U);
+};
+
+static RGS_INLINE bool RGSAssetFits(const RGSAssetPack* in_pack, uint64_t in_offset, uint64_t in_size) { return !(in_offset % RGS_ASSET_ALIGNMENT) && in_offset <= in_pack->size && in_size <= in_pack->size - in_offset; };
+
+static bool RGSWriteAssetBytes(RGSAssetFile inout_file, const void* in_data, size_t in_size) {
+#if RGS_OS == RGS_OS_WINDOWS
+	DWORD written_size = 0UL;
+	return WriteFile(inout_file, in_data, (DWORD)(in_size), &written_size, NULL) && written_size == (DWORD)(in_size);
+#elif RGS_OS == RGS_OS_LINUX
+	return fwrite(in_data, 1U, in_size, inout_file) == in_size;
+#endif
+};
+
+static bool RGSWriteAssetData(RGSAssetFile inout_file, uint64_t* inout_position, const void* in_data, size_t in_size, uint64_t in_offset) {
+	static const uint8_t padding_data[RGS_ASSET_ALIGNMENT] = { 0U };
+	if (*inout_position > in_offset || in_offset - *inout_position > RGS_ASSET_ALIGNMENT) return false;
+	if (in_offset > *inout_position && !RGSWriteAssetBytes(inout_file, padding_data, (size_t)(in_offset - *inout_position))) return false;
+	if (in_size && !RGSWriteAssetBytes(inout_file, in_data, in_size)) return false;
+	*inout_position = in_offset + in_size;
+	return true;
+};
+
+static bool RGSCheckAssetPack(const RGSAssetPack* in_pack) {
+	const RGSAssetHeader* const header = in_pack->header;
+	if (in_pack->size < sizeof(*header) || header->magic != RGS_ASSET_MAGIC) {
+		RGSReportError("Assets", "File isn't an asset pack", false);
+		return false;
+	};
+	if (header->version != RGS_ASSET_VERSION || header->header_size < sizeof(*header)) {
+		RGSReportError("Assets", "Asset pack version isn't supported", false);
+		return false;
+	};
+	if (!RGSValidAssetFormat(header)) {
+		RGSReportError("Assets", "Asset pack pattern format is invalid", false);
+		return false;
+	};
+	if (!RGSAssetFits(in_pack, header->pattern_offset, RGSAssetPatternSize(header) * header->pattern_count) ||
+		!RGSAssetFits(in_pack, header->colour_offset, (uint64_t)(header->colour_count) * sizeof(RGSColour)) ||
+		!RGSAssetFits(in_pack, header->palette_offset, (uint64_t)(header->palette_count) * sizeof(RGSPalette8)) ||
+		!RGSAssetFits(in_pack, header->tilemap_offset, (uint64_t)(header->tilemap_count) * sizeof(RGSAssetTileMap))) {
+		RGSReportError("Assets", "Asset pack sections are misaligned or outside the file", false);
+		return false;
+	};
+	const RGSAssetTileMap* const tilemap_data = (const RGSAssetTileMap*)(in_pack->data + header->tilemap_offset);
+	for (uint32_t tilemap_index = 0U; tilemap_index < header->tilemap_count; tilemap_index++) {
+		const uint64_t tile_count = (uint64_t)(tilemap_data[tilemap_index].width) * tilemap_data[tilemap_index].height;
+		if (!RGSAssetFits(in_pack, tilemap_data[tilemap_index].offset, tile_count * sizeof(RGSTile))) {
+			RGSReportError("Assets", "Asset pack tile map is misaligned or outside the file", false);
+			return false;
+		};
+		const uint8_t* const tile_data = in_pack->data + tilemap_data[tilemap_index].offset;
+		for (uint64_t tile_index = 0U; tile_index < tile_count; tile_index++) {
+			const uint8_t* const tile_bytes = tile_data + (tile_index * sizeof(RGSTile));
+			if ((tile_bytes[offsetof(RGSTile, hflip)] | tile_bytes[offsetof(RGSTile, vflip)]) > 1U) {
+				RGSReportError("Assets", "Asset pack tile map has flip flags other than 0 or 1", false);
+				return false;
+			};
+		};
+	};
+	return true;
+};
+
+static void RGSUnmapAssetPack(RGSAssetPack* inout_pack) {
+#if RGS_OS == RGS_OS_WINDOWS
+	if (inout_pack->data) UnmapViewOfFile((LPCVOID)(inout_pack->data));
+	if (inout_pack->mapping) CloseHandle(inout_pack->mapping);
+	if (inout_pack->file != INVALID_HANDLE_VALUE) CloseHandle(inout_pack->file);
+#elif RGS_OS == RGS_OS_LINUX
+	if (inout_pack->data) munmap((void*)(inout_pack->data), inout_pack->size);
+#endif
+	free((void*)(inout_pack));
+};
+
+static void RGSReleaseAssetPack(void* inout_data) { RGSUnmapAssetPack((RGSAssetPack*)(inout_data)); };
+
+
+/// Exposed Asset Functions
+
+
+bool RGSSaveAssetPack(const char* in_path, const RGSAssetDesc* in_desc) {
+	if (!in_path || !in_desc) return false;
+	RGSAssetHeader header = { 0 };
+	header.magic = RGS_ASSET_MAGIC;
+	header.version = RGS_ASSET_VERSION;
+	header.header_size = (uint16_t)(sizeof(header));
+	header.bits_per_pixel = (uint8_t)(in_desc->bits_per_pixel);
+	header.pattern_width = (uint8_t)(in_desc->pattern_width);
+	header.pattern_height = (uint8_t)(in_desc->pattern_height);
+	header.pattern_count = in_desc->patterns ? in_desc->pattern_count : 0U;
+	header.colour_count = in_desc->colours ? in_desc->colour_count : 0U;
+	header.palette_count = in_desc->palettes ? in_desc->palette_count : 0U;
+	header.tilemap_count = in_desc->tilemaps ? in_desc->tilemap_count : 0U;
+	const uint64_t pattern_offset = RGSAlignAsset(sizeof(header));
+	const uint64_t colour_offset = RGSAlignAsset(pattern_offset + (RGSAssetPatternSize(&header) * header.pattern_count));
+	const uint64_t palette_offset = RGSAlignAsset(colour_offset + ((uint64_t)(header.colour_count) * sizeof(RGSColour)));
+	const uint64_t tilemap_offset = RGSAlignAsset(palette_offset + ((uint64_t)(header.palette_count) * sizeof(RGSPalette8)));
+	uint64_t tile_offset = RGSAlignAsset(tilemap_offset + ((uint64_t)(header.tilemap_count) * sizeof(RGSAssetTileMap)));
+	for (uint32_t tilemap_index = 0U; tilemap_index < header.tilemap_count; tilemap_index++) tile_offset = RGSAlignAsset(tile_offset + ((uint64_t)(in_desc->tilemaps[tilemap_index].width) * in_desc->tilemaps[tilemap_index].height * sizeof(RGSTile)));
+	header.pattern_offset = (uint32_t)(pattern_offset);
+	header.colour_offset = (uint32_t)(colour_offset);
+	header.palette_offset = (uint32_t)(palette_offset);
+	header.tilemap_offset = (uint32_t)(tilemap_offset);
+	if (!RGSValidAssetFormat(&header)) {
+		RGSReportError("Assets", "Asset pack pattern format is invalid", false);
+		return false;
+	};
+	if (tile_offset > UINT32_MAX) {
+		RGSReportError("Assets", "Asset pack is too large", false);
+		return false;
+	};
+#if RGS_OS == RGS_OS_WINDOWS
+	const RGSAssetFile pack_file = CreateFileA(in_path, GENERIC_WRITE, 0U, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (pack_file == INVALID_HANDLE_VALUE) {
+#elif RGS_OS == RGS_OS_LINUX
+	const RGSAssetFile pack_file = fopen(in_path, "wb");
+	if (!pack_file) {
+#endif
+		RGSReportError("Assets", "Failed to create asset pack", false);
+		return false;
+	};
+	uint64_t file_position = 0U;
+	bool written = RGSWriteAssetData(pack_file, &file_position, &header, sizeof(header), 0U);
+	written = written && RGSWriteAssetData(pack_file, &file_position, in_desc->patterns, (size_t)(RGSAssetPatternSize(&header) * header.pattern_count), header.pattern_offset);
+	written = written && RGSWriteAssetData(pack_file, &file_position, in_desc->colours, (size_t)(header.colour_count) * sizeof(RGSColour), header.colour_offset);
+	written = written && RGSWriteAssetData(pack_file, &file_position, in_desc->palettes, (size_t)(header.palette_count) * sizeof(RGSPalette8), header.palette_offset);
+	tile_offset = RGSAlignAsset(tilemap_offset + ((uint64_t)(header.tilemap_count) * sizeof(RGSAssetTileMap)));
+	for (uint32_t tilemap_index = 0U; written && tilemap_index < header.tilemap_count; tilemap_index++) {
+		const RGSAssetTileMap tilemap_data = { in_desc->tilemaps[tilemap_index].width, in_desc->tilemaps[tilemap_index].height, (uint32_t)(tile_offset) };
+		written = RGSWriteAssetData(pack_file, &file_position, &tilemap_data, sizeof(tilemap_data), header.tilemap_offset + ((uint64_t)(tilemap_index) * sizeof(tilemap_data)));
+		tile_offset = RGSAlignAsset(tile_offset + ((uint64_t)(tilemap_data.width) * tilemap_data.height * sizeof(RGSTile)));
+	};
+	tile_offset = RGSAlignAsset(tilemap_offset + ((uint64_t)(header.tilemap_count) * sizeof(RGSAssetTileMap)));
+	for (uint32_t tilemap_index = 0U; written && tilemap_index < header.tilemap_count; tilemap_index++) {
+		const size_t tile_size = (size_t)(in_desc->tilemaps[tilemap_index].width) * in_desc->tilemaps[tilemap_index].height * sizeof(RGSTile);
+		written = RGSWriteAssetData(pack_file, &file_position, in_desc->tilemaps[tilemap_index].tiles, tile_size, tile_offset);
+		tile_offset = RGSAlignAsset(tile_offset + tile_size);
+	};
+#if RGS_OS == RGS_OS_WINDOWS
+	if (!CloseHandle(pack_file)) written = false;
+#elif RGS_OS == RGS_OS_LINUX
+	if (fclose(pack_file)) written = false;
+#endif
+	if (!written) RGSReportError("Assets", "Failed to write asset pack", false);
+	return written;
+};
+
+RGSAssetPack* RGSOpenAssetPack(const char* in_path) {
+	if (!in_path) return RGS_NULL;
+	RGSAssetPack* const asset_pack = (RGSAssetPack*)(calloc(1U, sizeof(*asset_pack)));
+	if (!asset_pack) {
+		RGSReportError("Assets", "Failed to allocate asset pack", false);
+		return RGS_NULL;
+	};
+#if RGS_OS == RGS_OS_WINDOWS
+	asset_pack->file = CreateFileA(in_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+	LARGE_INTEGER file_size = { 0 };
+	if (asset_pack->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(asset_pack->file, &file_size) || !file_size.QuadPart) {
+		RGSReportError("Assets", "Failed to open asset pack", false);
+		RGSUnmapAssetPack(asset_pack);
+		return RGS_NULL;
+	};
+	asset_pack->size = (size_t)(file_size.QuadPart);
+	asset_pack->mapping = CreateFileMappingA(asset_pack->file, NULL, PAGE_WRITECOPY, 0UL, 0UL, NULL);
+	if (asset_pack->mapping) asset_pack->data = (uint8_t*)(MapViewOfFile(asset_pack->mapping, FILE_MAP_COPY, 0UL, 0UL, 0U));
+	if (!asset_pack->data) {
+		RGSReportError("Assets", "Failed to map asset pack", false);
+		RGSUnmapAssetPack(asset_pack);
+		return RGS_NULL;
+	};
+#elif RGS_OS == RGS_OS_LINUX
+	const int pack_file = open(in_path, O_RDONLY);
+	struct stat file_status;
+	if (pack_file < 0 || fstat(pack_file, &file_status) || file_status.st_size <= 0) {
+		if (pack_file >= 0) close(pack_file);
+		RGSReportError("Assets", "Failed to open asset pack", false);
+		RGSUnmapAssetPack(asset_pack);
+		return RGS_NULL;
+	};
+	asset_pack->size = (size_t)(file_status.st_size);
+	void* const mapped_data = mmap(NULL, asset_pack->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, pack_file, 0);
+	close(pack_file);
+	if (mapped_data == MAP_FAILED) {
+		RGSReportError("Assets", "Failed to map asset pack", false);
+		RGSUnmapAssetPack(asset_pack);
+		return RGS_NULL;
+	};
+	asset_pack->data = (uint8_t*)(mapped_data);
+	madvise(mapped_data, asset_pack->size, MADV_WILLNEED);
+#endif
+	asset_pack->header = (const RGSAssetHeader*)(asset_pack->data);
+	if (!RGSCheckAssetPack(asset_pack)) {
+		RGSUnmapAssetPack(asset_pack);
+		return RGS_NULL;
+	};
+	return asset_pack;
+};
+
+void RGSCloseAssetPack(RGSAssetPack* inout_pack) {
+	if (!inout_pack) return;
+	if (!RGSUnbindPatterns(inout_pack->data + inout_pack->header->pattern_offset)) {
+		RGSReportWarning("Assets", "Asset packs can only be closed while beginning, updating or ending");
+		return;
+	};
+	if (!RGSDeferRelease(RGSReleaseAssetPack, (void*)(inout_pack))) RGSReportWarning("Assets", "Failed to queue asset pack for unmapping, leaving it mapped");
+};
+
+
+void RGSReadAssetDesc(const RGSAssetPack* in_pack, RGSAssetDesc* out_desc) {
+	if (!in_pack || !out_desc) return;
+	const RGSAssetHeader* const header = in_pack->header;
+	out_desc->bits_per_pixel = header->bits_per_pixel;
+	out_desc->pattern_width = header->pattern_width;
+	out_desc->pattern_height = header->pattern_height;
+	out_desc->pattern_count = header->pattern_count;
+	out_desc->patterns = in_pack->data + header->pattern_offset;
+	out_desc->colour_count = header->colour_count;
+	out_desc->colours = (const RGSColour*)(in_pack->data + header->colour_offset);
+	out_desc->palette_count = header->palette_count;
+	out_desc->palettes = (const RGSPalette8*)(in_pack->data + header->palette_offset);
+	out_desc->tilemap_count = header->tilemap_count;
+	out_desc->tilemaps = RGS_NULL;
+};
+
+bool RGSReadAssetTileMap(const RGSAssetPack* in_pack, uint32_t in_index, RGSTileMapDesc* out_tilemap) {
+	if (!in_pack || !out_tilemap || in_index >= in_pack->header->tilemap_count) return false;
+	const RGSAssetTileMap* const tilemap_data = (const RGSAssetTileMap*)(in_pack->data + in_pack->header->tilemap_offset) + in_index;
+	out_tilemap->width = tilemap_data->width;
+	out_tilemap->height = tilemap_data->height;
+	out_tilemap->tiles = (const RGSTile*)(in_pack->data + tilemap_data->offset);
+	return true;
+};
+
+RGSPalette RGSReadAssetPalette(const RGSAssetPack* in_pack, uint32_t in_index) {
+	if (!in_pack || in_index >= in_pack->header->palette_count) return RGS_NULL;
+	return in_pack->data + in_pack->header->palette_offset + ((size_t)(in_index) * sizeof(RGSPalette8));
+};
+
+
+bool RGSUseAssetPatterns(RGSAssetPack* inout_pack) {
+	if (!inout_pack) return false;
+	const RGSAssetHeader* const header = inout_pack->header;
+	return RGSBindPatterns(inout_pack->data + header->pattern_offset, header->pattern_count, header->bits_per_pixel, header->pattern_width, header->pattern_height);
+};
+
+void RGSUseAssetColours(const RGSAssetPack* in_pack) {
+	if (!in_pack) return;
+	const RGSColour* const colour_data = (const RGSColour*)(in_pack->data + in_pack->header->colour_offset);
+	const uint32_t colour_count = in_pack->header->colour_count < (1U << in_pack->header->bits_per_pixel) ? in_pack->header->colour_count : (1U << in_pack->header->bits_per_pixel);
+	for (uint32_t colour_index = 0U; colour_index < colour_count; colour_index++) RGSSetColour((uint8_t)(colour_index), colour_data[colour_index]);
+};
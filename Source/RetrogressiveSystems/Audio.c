@@ -16,6 +16,12 @@
 #endif
 
 
+#if RGS_OS == RGS_OS_LINUX
+#define RGS_AUDIO_NULL_SAMPLES 48000U
+#define RGS_AUDIO_NULL_CHANNELS 2U
+#endif
+
+
 /// Internal Audio Types
 
 typedef enum RGSAudioActionType {
@@ -71,6 +77,10 @@ static IMMDeviceEnumerator* g_enumerator = NULL;
 static IMMDevice* g_device = NULL;
 static IAudioClient* g_client = NULL;
 static IAudioRenderClient* g_renderer = NULL;
+#elif RGS_OS == RGS_OS_LINUX
+static size_t g_fcount = 0U;
+static float* g_buffer = RGS_NULL;
+static RGSTime g_remainder = 0ULL;
 #endif
 
 
@@ -155,6 +165,14 @@ static bool RGSCheckAudio() {
 	g_device = audio_device;
 	g_client = audio_client;
 	g_renderer = audio_renderer;
+#elif RGS_OS == RGS_OS_LINUX
+	if (g_buffer) return true;
+	const size_t frame_count = (size_t)(RGS_AUDIO_NULL_SAMPLES / 10U);
+	float* buffer_data = (float*)(malloc(frame_count * RGS_AUDIO_NULL_CHANNELS * sizeof(*buffer_data)));
+	if (!buffer_data) return false;
+	g_samples = (size_t)(RGS_AUDIO_NULL_SAMPLES);
+	g_fcount = frame_count;
+	g_buffer = buffer_data;
 #endif
 	return true;
 };
@@ -238,6 +256,8 @@ void RGSReleaseAudio() {
 	RGSDestroyLock(RGS_LOCK_PASS(g_lock));
 #if RGS_OS == RGS_OS_WINDOWS
 	g_enumerator->lpVtbl->Release(g_enumerator);
+#elif RGS_OS == RGS_OS_LINUX
+	if (g_buffer) free(g_buffer);
 #endif
 	if (g_alist) free(g_alist);
 	if (g_ilist) free(g_ilist);
@@ -318,11 +338,21 @@ void RGSRenderAudio() {
 				g_rendered = current_time;
 				return;
 			};
+#elif RGS_OS == RGS_OS_LINUX
+			const RGSTime sample_time = (elapsed_time * (RGSTime)(g_samples)) + g_remainder;
+			size_t frame_count = (size_t)(sample_time / RGS_ONE_SECOND);
+			g_remainder = sample_time % RGS_ONE_SECOND;
+			if (frame_count > g_fcount) {
+				frame_count = g_fcount;
+				g_remainder = 0ULL;
+			};
 #endif
 			size_t action_index = 0U;
 			RGSActivateLock(RGS_LOCK_PASS(g_lock));
 #if RGS_OS == RGS_OS_WINDOWS
 			if (g_format->Format.wBitsPerSample == 32U) RGSRenderAudio32((size_t)(g_format->Format.nChannels), (size_t)(frame_count), (float*)(buffer_data));
+#elif RGS_OS == RGS_OS_LINUX
+			RGSRenderAudio32((size_t)(RGS_AUDIO_NULL_CHANNELS), frame_count, g_buffer);
 #endif
 			while (action_index < g_acount) {
 				g_alist[action_index].offset += (1.0F / (float)(g_samples)) * (float)(frame_count) * g_alist[action_index].speed;
@@ -17,7 +17,7 @@ static bool g_running = true;
 
 /// Internal Game Functions
 
-#if RGS_BUILD == RGS_BUILD_DEBUG
+#if RGS_BUILD == RGS_BUILD_DEBUG || RGS_OS == RGS_OS_LINUX
 int main()
 #else
 #if RGS_OS == RGS_OS_WINDOWS
@@ -46,7 +46,9 @@ int WINAPI WinMain(HINSTANCE in_instance, HINSTANCE in_previous, LPSTR in_comman
 		1024, 1024,
 		32U, 32U, 256U,
 		8U, 60U,
-		true
+		true,
+		false, false, 0U, false, false,
+		1U
 	};
 	RGSConfigure(&game_info, &audio_info, &graphics_info);
 	if (!g_running || !RGSSafe()) {
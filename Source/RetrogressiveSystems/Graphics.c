@@ -3,17 +3,42 @@
 
 #include <RetrogressiveSystems/Output.h>
 
+#include "./Output.inl"
 #include "./Input.inl"
 #include "./Game.inl"
 
+#include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 
 #if RGS_OS == RGS_OS_WINDOWS
 #include <windowsx.h>
 #define RGS_GRAPHICS_CLASS_NAME "RGSWindow"
+#elif RGS_OS == RGS_OS_LINUX
+#include <signal.h>
+#include <stdio.h>
 #endif
 
+#if RGS_ARCH == RGS_ARCH_X64 && !defined(RGS_NO_SIMD)
+#define RGS_GRAPHICS_SIMD 1
+#else
+#define RGS_GRAPHICS_SIMD 0
+#endif
+
+#if !defined(RGS_NO_SPECIALISATION)
+#define RGS_GRAPHICS_SPECIALISED 1
+#else
+#define RGS_GRAPHICS_SPECIALISED 0
+#endif
+
+#define RGS_GRAPHICS_BAND_LIMIT 64
+#define RGS_GRAPHICS_ARENA_SIZE 65536
+#define RGS_GRAPHICS_PALETTE_COPIES 64
+#define RGS_GRAPHICS_BANK_LIMIT 256
+#define RGS_GRAPHICS_BLEND_MODES 6
+#define RGS_GRAPHICS_BLEND_CELLS 512
+
 
 /// Internal Graphics Types
 
@@ -26,6 +51,155 @@ typedef struct RGSGraphicsThreadParameters {
 #endif
 } RGSGraphicsThreadParameters;
 
+typedef enum RGSDrawCommandType {
+	RGS_DRAW_COMMAND_TYPE_PIXEL,
+	RGS_DRAW_COMMAND_TYPE_SPRITES,
+	RGS_DRAW_COMMAND_TYPE_TILES,
+	RGS_DRAW_COMMAND_TYPE_TILEMAP16,
+	RGS_DRAW_COMMAND_TYPE_BITMAP,
+	RGS_DRAW_COMMAND_TYPE_RECT,
+	RGS_DRAW_COMMAND_TYPE_LINE,
+	RGS_DRAW_COMMAND_TYPE_CIRCLE,
+} RGSDrawCommandType;
+
+typedef struct RGSDrawCommand {
+	RGSDrawCommandType type;
+	const uint8_t* patterns;
+	const uint8_t* blend;
+	union {
+		struct {
+			int x;
+			int y;
+			uint8_t index;
+		} pixel;
+		struct {
+			const RGSSpriteDesc* list;
+			size_t count;
+			bool sort;
+		} sprites;
+		struct {
+			int x;
+			int y;
+			const RGSTile* list;
+			const RGSPalette* palettes;
+			bool hwrap;
+			bool vwrap;
+			bool transparent;
+		} tiles;
+		struct {
+			int x;
+			int y;
+			const RGSTile16* list;
+			const RGSPalette* palettes;
+			bool hwrap;
+			bool vwrap;
+			bool transparent;
+			uint32_t priorities;
+		} tilemap16;
+		struct {
+			int x;
+			int y;
+			RGSBitmap desc;
+			RGSPalette palette;
+			bool hflip;
+			bool vflip;
+			bool hwrap;
+			bool vwrap;
+		} bitmap;
+		struct {
+			int x;
+			int y;
+			int width;
+			int height;
+			uint8_t index;
+		} rect;
+		struct {
+			int start_x;
+			int start_y;
+			int end_x;
+			int end_y;
+			uint8_t index;
+		} line;
+		struct {
+			int x;
+			int y;
+			int radius;
+			uint8_t index;
+		} circle;
+	};
+} RGSDrawCommand;
+
+typedef struct RGSColourCycle {
+	RGSTime started;
+	RGSTime period;
+	int first;
+	int count;
+	bool reverse;
+} RGSColourCycle;
+
+typedef struct RGSColourFade {
+	RGSTime started;
+	RGSTime duration;
+	RGSColour colour;
+	int from;
+	int to;
+} RGSColourFade;
+
+typedef struct RGSColourFlash {
+	RGSTime started;
+	RGSTime attack;
+	RGSTime hold;
+	RGSTime release;
+	RGSColour colour;
+	bool active;
+} RGSColourFlash;
+
+typedef struct RGSPatternAnimation {
+	RGSTime started;
+	RGSTime frame_time;
+	RGSPattern* frames;
+	uint32_t count;
+} RGSPatternAnimation;
+
+typedef struct RGSArenaBlock {
+	struct RGSArenaBlock* next;
+	size_t capacity;
+	size_t used;
+	uint8_t data[];
+} RGSArenaBlock;
+
+typedef struct RGSPaletteCopy {
+	RGSPalette source;
+	RGSPalette copy;
+} RGSPaletteCopy;
+
+typedef struct RGSDeferredRelease {
+	void (*release)(void*);
+	void* data;
+} RGSDeferredRelease;
+
+typedef struct RGSDrawKernels {
+	void(*draw_sprite)(int, int, RGSPattern, RGSPalette, bool, bool, bool, bool, int, int);
+	void(*draw_sprites)(const RGSSpriteDesc*, size_t, bool, int, int);
+	void(*draw_tiles)(int, int, const RGSTile*, const RGSPalette*, bool, bool, bool, int, int);
+	void(*draw_tilemap16)(int, int, const RGSTile16*, const RGSPalette*, bool, bool, bool, uint32_t, int, int);
+} RGSDrawKernels;
+
+typedef struct RGSPatternBankData {
+	uint8_t* live;
+	uint8_t* staged;
+	uint8_t* spare;
+	RGSCounter loading;
+	RGSCounter ready;
+} RGSPatternBankData;
+
+typedef struct RGSLineStep {
+	int64_t position;
+	int64_t remainder;
+	int64_t step;
+	int64_t limit;
+} RGSLineStep;
+
 
 /// Internal Graphics Variables
 
@@ -37,13 +211,76 @@ static int g_pwidth = 0;
 static int g_pheight = 0;
 
 static int g_pcount = 0;
-static uint8_t* g_pdata = RGS_NULL;
+static RGS_THREAD_LOCAL const uint8_t* g_pdata = RGS_NULL;
+static uint8_t* g_pstore = RGS_NULL;
+static RGSPatternBankData g_pbanks[RGS_GRAPHICS_BANK_LIMIT];
+static int g_pbcount = 1;
+static RGSPatternBank g_pselected = 0U;
+static RGSCounter g_ppending = RGSCreateCounter(0);
+static bool g_pflipped = false;
+static RGSPattern g_pframes[256];
+static RGSPatternAnimation g_panimations[256];
+static uint8_t* g_lstore = RGS_NULL;
+static uint8_t* g_lbank = RGS_NULL;
+static RGSPalette g_llist[256];
+static size_t g_lstride = 0U;
+static RGS_THREAD_LOCAL const uint8_t* g_mdata = RGS_NULL;
+static uint8_t* g_mtables[RGS_GRAPHICS_BLEND_MODES];
+static uint32_t g_mbuilt[RGS_GRAPHICS_BLEND_MODES];
+static uint32_t g_mversion = 1U;
+static uint8_t g_mcandidates[RGS_GRAPHICS_BLEND_CELLS][256];
+static int g_mccounts[RGS_GRAPHICS_BLEND_CELLS];
+static RGSBlendMode g_mselected = RGS_BLEND_NONE;
+static RGSColourCycle g_ecycles[RGS_COLOUR_CYCLE_LIMIT];
+static RGSColourFade g_efade = { 0U };
+static RGSColourFlash g_eflash = { 0U };
+static bool g_eactive = false;
+
+static uint8_t g_swiden[6][256][8];
+static uint8_t g_snarrow[6][256];
+static uint8_t g_sreverse[256];
+static uint64_t* g_skeys = RGS_NULL;
+static size_t g_scapacity = 0U;
+static uint32_t* g_scells = RGS_NULL;
+static uint32_t g_sstamp = 0U;
 static volatile bool g_modifying = false;
 
 static int g_bits = 0;
+static int g_depth = 0;
 static int g_colours = 0;
 static int g_length = 0;
+static uint8_t* g_buffers = RGS_NULL;
 static uint8_t* g_pixels = RGS_NULL;
+static uint8_t* g_front = RGS_NULL;
+static uint8_t* g_dcells = RGS_NULL;
+static uint8_t* g_dback = RGS_NULL;
+static uint8_t* g_dfront = RGS_NULL;
+static int g_dcolumns = 0;
+static int g_drows = 0;
+static volatile bool g_repaint = true;
+
+static RGSDrawCommand* g_clist = RGS_NULL;
+static size_t g_ccount = 0U;
+static size_t g_ccapacity = 0U;
+static bool g_ccovered = false;
+static bool g_deferred = false;
+static volatile bool g_cleared = true;
+static RGSDrawStats g_ctally = { 0U };
+static RGSDrawStats g_cstats = { 0U };
+static RGSArenaBlock* g_afirst = RGS_NULL;
+static RGSArenaBlock* g_alast = RGS_NULL;
+static RGSArenaBlock* g_acurrent = RGS_NULL;
+static RGSPaletteCopy g_acopies[RGS_GRAPHICS_PALETTE_COPIES];
+static RGSDeferredRelease* g_areleases = RGS_NULL;
+static size_t g_arcount = 0U;
+static size_t g_arcapacity = 0U;
+static int g_bcount = 1;
+static RGSThread g_workers[RGS_GRAPHICS_BAND_LIMIT - 1];
+static RGSLock g_wlock = RGS_LOCK_INVALID;
+static RGSCounter g_wgeneration = RGSCreateCounter(0);
+static RGSCounter g_wpending = RGSCreateCounter(0);
+static volatile bool g_wrunning = false;
+static RGSLock g_rlock = RGS_LOCK_INVALID;
 
 static RGSLock g_lock = RGS_LOCK_INVALID;
 static RGSThread g_thread = RGS_THREAD_INVALID;
@@ -58,30 +295,233 @@ static uint8_t(*g_get_pixel)(int, int) = RGS_NULL;
 static void(*g_set_pixel)(int, int, uint8_t) = RGS_NULL;
 static void(*g_read_pixels)(uint8_t*) = RGS_NULL;
 static void(*g_write_pixels)(const uint8_t*) = RGS_NULL;
-static void(*g_draw_sprite)(int, int, RGSPattern, RGSPalette, bool, bool, bool, bool) = RGS_NULL;
-static void(*g_draw_tiles)(int, int, const RGSTile*, const RGSPalette*, bool, bool, bool) = RGS_NULL;
+static void(*g_draw_sprite)(int, int, RGSPattern, RGSPalette, bool, bool, bool, bool, int, int) = RGS_NULL;
+static void(*g_draw_sprites)(const RGSSpriteDesc*, size_t, bool, int, int) = RGS_NULL;
+static void(*g_draw_tiles)(int, int, const RGSTile*, const RGSPalette*, bool, bool, bool, int, int) = RGS_NULL;
+static void(*g_draw_tilemap16)(int, int, const RGSTile16*, const RGSPalette*, bool, bool, bool, uint32_t, int, int) = RGS_NULL;
 
 #if RGS_OS == RGS_OS_WINDOWS
 static LPBITMAPINFO g_bitmap = NULL;
+static uint8_t* g_expanded = NULL;
+static LPBITMAPINFO g_ebitmap = NULL;
 static HINSTANCE g_instance = NULL;
 static HWND g_window = NULL;
 static volatile bool g_created = false;
+#elif RGS_OS == RGS_OS_LINUX
+static RGSColour* g_palette = RGS_NULL;
+static RGSColour* g_ecolours = RGS_NULL;
+static uint32_t* g_surface = RGS_NULL;
+static RGSTime g_opened = 0ULL;
+static RGSTime g_drawing = 0ULL;
+static RGSTime g_presenting = 0ULL;
+static uint64_t g_frames = 0ULL;
+static volatile sig_atomic_t g_closed = 0;
 #endif
 
 
 /// Internal Graphics Functions
 
+static RGS_INLINE size_t RGSPatternSlot(RGSPattern in_index) { return (size_t)(in_index % g_pcount) << (g_pflipped ? 2U : 0U); };
+
+static RGS_INLINE size_t RGSBankSize() { return ((size_t)(((g_pwidth * g_bits) >> 3) * g_pheight) * (size_t)(g_pcount)) << (g_pflipped ? 2U : 0U); };
+
+static RGS_INLINE bool RGSBankedPalette(RGSPalette in_palette) { return g_lbank && ((uintptr_t)(in_palette) - (uintptr_t)(g_lbank)) < (uintptr_t)(g_lstride << 8U); };
+
+static RGS_INLINE const uint8_t* RGSResolvePattern(RGSTile* inout_tile, int in_size) {
+	size_t pattern_slot = RGSPatternSlot(g_pframes[inout_tile->pattern]);
+	if (g_pflipped) {
+		pattern_slot |= (inout_tile->hflip ? 1U : 0U) | (inout_tile->vflip ? 2U : 0U);
+		inout_tile->hflip = false;
+		inout_tile->vflip = false;
+	};
+	return g_pdata + (in_size * pattern_slot);
+};
+
+static void RGSFlipPattern(uint8_t* inout_data, RGSPattern in_index) {
+	const int line_size = (g_pwidth * g_bits) >> 3;
+	const uint8_t sample_mask = (uint8_t)(g_colours - 1);
+	const uint8_t* const pattern_data = inout_data + ((line_size * g_pheight) * RGSPatternSlot(in_index));
+	for (int flip_index = 1; flip_index < 4; flip_index++) {
+		uint8_t* const flip_data = (uint8_t*)(pattern_data) + ((line_size * g_pheight) * flip_index);
+		for (int sample_y = 0; sample_y < g_pheight; sample_y++) {
+			const uint8_t* const line_data = pattern_data + (((flip_index & 2) ? (g_pheight - 1) - sample_y : sample_y) * line_size);
+			uint8_t* const flip_line = flip_data + (sample_y * line_size);
+			memset(flip_line, 0, (size_t)(line_size));
+			for (int sample_x = 0; sample_x < g_pwidth; sample_x++) {
+				const int source_bit = ((flip_index & 1) ? (g_pwidth - 1) - sample_x : sample_x) * g_bits;
+				const int target_bit = sample_x * g_bits;
+				const uint8_t sample_data = (line_data[source_bit >> 3] >> ((8 - g_bits) - (source_bit & 7))) & sample_mask;
+				flip_line[target_bit >> 3] |= (uint8_t)(sample_data << ((8 - g_bits) - (target_bit & 7)));
+			};
+		};
+	};
+};
+
+static RGS_INLINE int RGSBitsShift(int in_bits) { return in_bits == 8 ? 3 : in_bits >> 1; };
+
+static RGS_INLINE int RGSConversionIndex(int in_small, int in_large) { return ((RGSBitsShift(in_large) * (RGSBitsShift(in_large) - 1)) >> 1) + RGSBitsShift(in_small); };
+
+static void RGSPrepareConversions() {
+	for (int large_bits = 2; large_bits <= 8; large_bits <<= 1) {
+		for (int small_bits = 1; small_bits < large_bits; small_bits <<= 1) {
+			const int conversion_index = RGSConversionIndex(small_bits, large_bits);
+			for (int byte_value = 0; byte_value < 256; byte_value++) {
+				uint8_t* const widen_data = g_swiden[conversion_index][byte_value];
+				memset(widen_data, 0, sizeof(g_swiden[conversion_index][byte_value]));
+				for (int sample_index = 0; sample_index < 8 / small_bits; sample_index++) {
+					const int sample_data = (byte_value >> ((8 - small_bits) - (sample_index * small_bits))) & ((1 << small_bits) - 1);
+					const int target_bit = sample_index * large_bits;
+					widen_data[target_bit >> 3] |= (uint8_t)(sample_data << ((8 - large_bits) - (target_bit & 7)));
+				};
+				uint8_t narrow_data = 0U;
+				for (int sample_index = 0; sample_index < 8 / large_bits; sample_index++) {
+					narrow_data = (uint8_t)(narrow_data << small_bits) | (uint8_t)((byte_value >> ((8 - large_bits) - (sample_index * large_bits))) & ((1 << small_bits) - 1));
+				};
+				g_snarrow[conversion_index][byte_value] = narrow_data;
+			};
+		};
+	};
+	for (int byte_value = 0; byte_value < 256; byte_value++) {
+		uint8_t reverse_data = 0U;
+		for (int bit_index = 0; bit_index < 8; bit_index++) reverse_data |= (uint8_t)(((byte_value >> bit_index) & 1) << (7 - bit_index));
+		g_sreverse[byte_value] = reverse_data;
+	};
+};
+
+#if RGS_GRAPHICS_SIMD
+static size_t RGSConvertSamplesSSE2(const uint8_t* in_data, int in_bits, uint8_t* out_data, int out_bits, size_t in_size) {
+	const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+	size_t data_index = 0U;
+	if (in_bits == 4 && out_bits == 8) {
+		for (; data_index + 16U <= in_size; data_index += 16U, out_data += 32) {
+			const __m128i sample_data = _mm_loadu_si128((const __m128i*)(in_data + data_index));
+			const __m128i high_data = _mm_and_si128(_mm_srli_epi16(sample_data, 4), nibble_mask);
+			const __m128i low_data = _mm_and_si128(sample_data, nibble_mask);
+			_mm_storeu_si128((__m128i*)(out_data), _mm_unpacklo_epi8(high_data, low_data));
+			_mm_storeu_si128((__m128i*)(out_data + 16), _mm_unpackhi_epi8(high_data, low_data));
+		};
+	}
+	else if (in_bits == 8 && out_bits == 4) {
+		for (; data_index + 32U <= in_size; data_index += 32U, out_data += 16) {
+			const __m128i word_mask = _mm_set1_epi16(0x00FF);
+			__m128i sample_data = _mm_and_si128(_mm_loadu_si128((const __m128i*)(in_data + data_index)), nibble_mask);
+			const __m128i first_data = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(sample_data, word_mask), 4), _mm_srli_epi16(sample_data, 8));
+			sample_data = _mm_and_si128(_mm_loadu_si128((const __m128i*)(in_data + data_index + 16U)), nibble_mask);
+			const __m128i second_data = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(sample_data, word_mask), 4), _mm_srli_epi16(sample_data, 8));
+			_mm_storeu_si128((__m128i*)(out_data), _mm_packus_epi16(first_data, second_data));
+		};
+	}
+	else if (in_bits == 8 && out_bits == 1) {
+		for (; data_index + 16U <= in_size; data_index += 16U, out_data += 2) {
+			const int sample_mask = _mm_movemask_epi8(_mm_slli_epi16(_mm_loadu_si128((const __m128i*)(in_data + data_index)), 7));
+			out_data[0] = g_sreverse[sample_mask & 0xFF];
+			out_data[1] = g_sreverse[(sample_mask >> 8) & 0xFF];
+		};
+	};
+	return data_index;
+};
+#endif
+
+static void RGSConvertSamples(const uint8_t* in_data, int in_bits, uint8_t* out_data, int out_bits, size_t in_count) {
+	size_t in_size = (in_count * (size_t)(in_bits)) >> 3;
+	if (in_bits == out_bits) {
+		memcpy(out_data, in_data, in_size);
+		return;
+	};
+#if RGS_GRAPHICS_SIMD
+	const size_t converted_size = RGSConvertSamplesSSE2(in_data, in_bits, out_data, out_bits, in_size);
+	in_data += converted_size;
+	out_data += (converted_size * (size_t)(out_bits)) / (size_t)(in_bits);
+	in_size -= converted_size;
+#endif
+	const uint8_t* const data_end = in_data + in_size;
+	if (in_bits < out_bits) {
+		const uint8_t(*const widen_data)[8] = g_swiden[RGSConversionIndex(in_bits, out_bits)];
+		switch (out_bits / in_bits) {
+		case 2: for (; in_data < data_end; out_data += 2) memcpy(out_data, widen_data[*(in_data++)], 2U); break;
+		case 4: for (; in_data < data_end; out_data += 4) memcpy(out_data, widen_data[*(in_data++)], 4U); break;
+		case 8: for (; in_data < data_end; out_data += 8) memcpy(out_data, widen_data[*(in_data++)], 8U); break;
+		};
+	}
+	else {
+		const uint8_t* const narrow_data = g_snarrow[RGSConversionIndex(out_bits, in_bits)];
+		switch (in_bits / out_bits) {
+		case 2: for (; in_data < data_end; in_data += 2) *(out_data++) = (uint8_t)(narrow_data[in_data[0]] << 4U) | narrow_data[in_data[1]]; break;
+		case 4: for (; in_data < data_end; in_data += 4) *(out_data++) = (uint8_t)(narrow_data[in_data[0]] << 6U) | (uint8_t)(narrow_data[in_data[1]] << 4U) | (uint8_t)(narrow_data[in_data[2]] << 2U) | narrow_data[in_data[3]]; break;
+		case 8: {
+			for (; in_data < data_end; in_data += 8) {
+				uint8_t sample_data = 0U;
+				for (int sample_index = 0; sample_index < 8; sample_index++) sample_data = (uint8_t)(sample_data << 1U) | narrow_data[in_data[sample_index]];
+				*(out_data++) = sample_data;
+			};
+			break;
+		};
+		};
+	};
+};
+
+static void RGSConvertPatterns(uint8_t* out_data, RGSPattern in_first, uint32_t in_count, uint32_t in_bits, const uint8_t* in_data) {
+	const size_t sample_count = (size_t)(g_pwidth * g_pheight);
+	const size_t data_size = (sample_count * (size_t)(in_bits)) >> 3;
+	const size_t pattern_size = (sample_count * (size_t)(g_bits)) >> 3;
+	for (uint32_t pattern_index = 0U; pattern_index < in_count;) {
+		const size_t pattern_slot = ((size_t)(in_first) + pattern_index) % (size_t)(g_pcount);
+		uint32_t pattern_total = g_pflipped ? 1U : (uint32_t)((size_t)(g_pcount) - pattern_slot);
+		if (pattern_total > in_count - pattern_index) pattern_total = in_count - pattern_index;
+		uint8_t* const pattern_data = out_data + (pattern_size * RGSPatternSlot((RGSPattern)(pattern_slot)));
+		RGSConvertSamples(in_data + (data_size * pattern_index), (int)(in_bits), pattern_data, g_bits, sample_count * pattern_total);
+		if (g_bits != g_depth) {
+			for (size_t sample_index = 0U; sample_index < sample_count * pattern_total; sample_index++) pattern_data[sample_index] &= (uint8_t)(g_colours - 1);
+		};
+		if (g_pflipped) RGSFlipPattern(out_data, (RGSPattern)(pattern_slot));
+		pattern_index += pattern_total;
+	};
+};
+
+static RGS_INLINE void RGSMarkDirty(int in_x, int in_y, int in_width, int in_height) {
+	const int column_start = in_x / g_pwidth;
+	const int column_end = ((in_x + in_width) - 1) / g_pwidth;
+	const int row_end = ((in_y + in_height) - 1) / g_pheight;
+	for (int row_index = in_y / g_pheight; row_index <= row_end; row_index++) memset(g_dback + column_start + (row_index * g_dcolumns), 1, (size_t)((column_end - column_start) + 1));
+};
+
+static RGS_INLINE void RGSMarkDirtySegments(const int* in_columns, const int* in_widths, int in_column_total, const int* in_rows, const int* in_heights, int in_row_total) {
+	for (int row_index = 0; row_index < in_row_total; row_index++) {
+		for (int column_index = 0; column_index < in_column_total; column_index++) RGSMarkDirty(in_columns[column_index], in_rows[row_index], in_widths[column_index], in_heights[row_index]);
+	};
+};
+
+static void RGSClearDirty() {
+	const int cell_size = (g_pwidth * g_bits) >> 3;
+	for (int row_index = 0; row_index < g_drows; row_index++) {
+		const uint8_t* const dirty_data = g_dback + (row_index * g_dcolumns);
+		for (int column_index = 0; column_index < g_dcolumns; column_index++) {
+			if (!dirty_data[column_index]) continue;
+			const int column_start = column_index;
+			while (column_index < g_dcolumns && dirty_data[column_index]) column_index++;
+			uint8_t* pixel_data = g_pixels + (column_start * cell_size) + ((row_index * g_pheight) * g_length);
+			for (int pixel_y = 0; pixel_y < g_pheight; pixel_y++, pixel_data += g_length) memset((void*)(pixel_data), 0, (size_t)((column_index - column_start) * cell_size));
+		};
+	};
+	memset((void*)(g_dback), 0, (size_t)(g_dcolumns * g_drows));
+};
+
 static uint8_t RGSGetPixel1(int in_x, int in_y) {
 	const uint8_t sample_data = g_pixels[(in_x >> 3) + (in_y * g_length)];
 	return (sample_data >> (uint8_t)(7 - (in_x & 7))) & ((1U << 1U) - 1U);
 };
 
+static uint8_t RGSGetPixel2(int in_x, int in_y) {
+	const uint8_t sample_data = g_pixels[(in_x >> 2) + (in_y * g_length)];
+	return (sample_data >> (uint8_t)((3 - (in_x & 3)) << 1)) & ((1U << 2U) - 1U);
+};
+
 static uint8_t RGSGetPixel4(int in_x, int in_y) {
 	const uint8_t sample_data = g_pixels[(in_x >> 1) + (in_y * g_length)];
 	return ((in_x & 1) ? sample_data : (sample_data >> 4U)) & ((1U << 4U) - 1U);
 };
 
-static uint8_t RGSGetPixel8(int in_x, int in_y) { return g_pixels[in_x + (in_y * g_length)]; };
+static uint8_t RGSGetPixel8(int in_x, int in_y) { return g_pixels[in_x + (in_y * g_length)] & (uint8_t)(g_colours - 1); };
 
 
 static void RGSSetPixel1(int in_x, int in_y, uint8_t in_index) {
@@ -90,6 +530,13 @@ static void RGSSetPixel1(int in_x, int in_y, uint8_t in_index) {
 	g_pixels[sample_index] = (sample_data & (uint8_t)(~(1 << (7 - (in_x & 7))))) | ((in_index & (uint8_t)(g_colours - 1)) << (7 - (in_x & 7)));
 };
 
+static void RGSSetPixel2(int in_x, int in_y, uint8_t in_index) {
+	const size_t sample_index = (size_t)((in_x >> 2) + (in_y * g_length));
+	const uint8_t sample_data = g_pixels[sample_index];
+	const int sample_shift = (3 - (in_x & 3)) << 1;
+	g_pixels[sample_index] = (sample_data & (uint8_t)(~(0b11U << sample_shift))) | ((in_index & (uint8_t)(g_colours - 1)) << sample_shift);
+};
+
 static void RGSSetPixel4(int in_x, int in_y, uint8_t in_index) {
 	const size_t sample_index = (size_t)((in_x >> 1) + (in_y * g_length));
 	const uint8_t sample_data = g_pixels[sample_index];
@@ -113,26 +560,28 @@ static void RGSReadPixels1(uint8_t* out_pixels) {
 	};
 };
 
-static void RGSReadPixels4(uint8_t* out_pixels) {
-	if (g_colours < (1 << 4)) {
+static void RGSReadPixels2(uint8_t* out_pixels) {
+	if ((g_length << 2) == g_swidth) memcpy(out_pixels, g_pixels, g_length * g_sheight);
+	else {
+		size_t pixel_index = 0U;
+		const size_t line_size = (size_t)((g_swidth + 3) >> 2);
 		for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++) {
-			for (int pixel_x = 0; pixel_x < g_swidth; pixel_x += 4) {
-				const uint8_t pixel_data1 = g_pixels[(pixel_x >> 1) + (pixel_y * g_length)];
-				const uint8_t pixel_data2 = g_pixels[((pixel_x + 2) >> 1) + (pixel_y * g_length)];
-				*(out_pixels++) = (((pixel_data1 >> 4) & 3) << 6) | ((pixel_data1 & 3) << 4) | (((pixel_data2 >> 4) & 3) << 2) | (pixel_data2 & 3);
-			};
+			memcpy(out_pixels, g_pixels + pixel_index, line_size);
+			out_pixels += line_size;
+			pixel_index += g_length;
 		};
-	}
+	};
+};
+
+static void RGSReadPixels4(uint8_t* out_pixels) {
+	if ((g_length << 1) == g_swidth) memcpy(out_pixels, g_pixels, g_length * g_sheight);
 	else {
-		if ((g_length << 1) == g_swidth) memcpy(out_pixels, g_pixels, g_length * g_sheight);
-		else {
-			size_t pixel_index = 0U;
-			const size_t line_size = (size_t)((g_swidth + 1) >> 1);
-			for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++) {
-				memcpy(out_pixels, g_pixels + pixel_index, line_size);
-				out_pixels += line_size;
-				pixel_index += g_length;
-			};
+		size_t pixel_index = 0U;
+		const size_t line_size = (size_t)((g_swidth + 1) >> 1);
+		for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++) {
+			memcpy(out_pixels, g_pixels + pixel_index, line_size);
+			out_pixels += line_size;
+			pixel_index += g_length;
 		};
 	};
 };
@@ -163,26 +612,28 @@ static void RGSWritePixels1(const uint8_t* in_pixels) {
 	};
 };
 
-static void RGSWritePixels4(const uint8_t* in_pixels) {
-	if (g_colours < (1 << 4)) {
+static void RGSWritePixels2(const uint8_t* in_pixels) {
+	if ((g_length << 2) == g_swidth) memcpy(g_pixels, in_pixels, g_length * g_sheight);
+	else {
+		size_t pixel_index = 0U;
+		const size_t line_size = (size_t)((g_swidth + 3) >> 2);
 		for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++) {
-			for (int pixel_x = 0; pixel_x < g_swidth; pixel_x += 4) {
-				const uint8_t pixel_data = *in_pixels;
-				g_pixels[(pixel_x >> 1) + (pixel_y * g_length)] = (((pixel_data >> 6) & 3) << 4) | ((pixel_data >> 4) & 3);
-				g_pixels[((pixel_x + 2) >> 1) + (pixel_y * g_length)] = (((pixel_data >> 2) & 3) << 4) | (pixel_data & 3);
-			};
+			memcpy(g_pixels + pixel_index, in_pixels, line_size);
+			in_pixels += line_size;
+			pixel_index += g_length;
 		};
-	}
+	};
+};
+
+static void RGSWritePixels4(const uint8_t* in_pixels) {
+	if ((g_length << 1) == g_swidth) memcpy(g_pixels, in_pixels, g_length * g_sheight);
 	else {
-		if ((g_length << 1) == g_swidth) memcpy(g_pixels, in_pixels, g_length * g_sheight);
-		else {
-			size_t pixel_index = 0U;
-			const size_t line_size = (size_t)((g_swidth + 1) >> 1);
-			for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++) {
-				memcpy(g_pixels + pixel_index, in_pixels, line_size);
-				in_pixels += line_size;
-				pixel_index += g_length;
-			};
+		size_t pixel_index = 0U;
+		const size_t line_size = (size_t)((g_swidth + 1) >> 1);
+		for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++) {
+			memcpy(g_pixels + pixel_index, in_pixels, line_size);
+			in_pixels += line_size;
+			pixel_index += g_length;
 		};
 	};
 };
@@ -199,251 +650,1659 @@ static void RGSWritePixels8(const uint8_t* in_pixels) {
 	};
 };
 
+static void RGSPackPixels(const uint8_t* in_pixels, uint8_t* out_data, int in_count) {
+	const int packed_count = in_count & ~((8 / g_depth) - 1);
+	RGSConvertSamples(in_pixels, 8, out_data, g_depth, (size_t)(packed_count));
+	if (packed_count == in_count) return;
+	uint8_t sample_data = 0U;
+	for (int sample_index = packed_count; sample_index < in_count; sample_index++) sample_data |= (uint8_t)((in_pixels[sample_index] & (g_colours - 1)) << (8 - (((sample_index - packed_count) + 1) * g_depth)));
+	out_data[(packed_count * g_depth) >> 3] = sample_data;
+};
 
-static void RGSDrawSprite1(int in_x, int in_y, RGSPattern in_pattern, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap) {
-	if (in_hwrap) in_x = in_x >= 0 ? (in_x % g_cwidth) : (g_cwidth + (in_x % g_cwidth));
-	if (in_vwrap) in_y = in_y >= 0 ? (in_y % g_cheight) : (g_cheight + (in_y % g_cheight));
-	const uint8_t* pattern_data = g_pdata + (((g_pwidth >> 3) * g_pheight) * (size_t)(in_pattern % g_pcount));
-	for (int sample_y = 0; sample_y < g_pheight; sample_y++) {
-		int pixel_y = in_y + sample_y;
-		if (in_vwrap) {
-			if (pixel_y >= g_cheight) pixel_y %= g_cheight;
-			if (pixel_y >= g_sheight) continue;
-		}
+static void RGSUnpackPixels(const uint8_t* in_data, uint8_t* out_pixels, int in_count) {
+	const int packed_count = in_count & ~((8 / g_depth) - 1);
+	RGSConvertSamples(in_data, g_depth, out_pixels, 8, (size_t)(packed_count));
+	for (int sample_index = packed_count; sample_index < in_count; sample_index++) out_pixels[sample_index] = (uint8_t)(in_data[(packed_count * g_depth) >> 3] >> (8 - (((sample_index - packed_count) + 1) * g_depth))) & (uint8_t)(g_colours - 1);
+};
+
+static void RGSReadPixelsUnpacked(uint8_t* out_pixels) {
+	const size_t line_size = (size_t)(((g_swidth * g_depth) + 7) >> 3);
+	for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++, out_pixels += line_size) RGSPackPixels(g_pixels + (pixel_y * g_length), out_pixels, g_swidth);
+};
+
+static void RGSWritePixelsUnpacked(const uint8_t* in_pixels) {
+	const size_t line_size = (size_t)(((g_swidth * g_depth) + 7) >> 3);
+	for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++, in_pixels += line_size) RGSUnpackPixels(in_pixels, g_pixels + (pixel_y * g_length), g_swidth);
+};
+
+
+static void RGSReadPixelRows(int in_x, int in_y, int in_width, int in_height, uint8_t* out_pixels) {
+	if (g_bits != g_depth) {
+		const size_t line_size = (size_t)(((in_width * g_depth) + 7) >> 3);
+		for (int pixel_y = 0; pixel_y < in_height; pixel_y++, out_pixels += line_size) RGSPackPixels(g_pixels + in_x + ((in_y + pixel_y) * g_length), out_pixels, in_width);
+		return;
+	};
+	const int bit_start = in_x * g_bits;
+	const int bit_shift = bit_start & 7;
+	const int bit_count = in_width * g_bits;
+	const size_t line_size = (size_t)((bit_count + 7) >> 3);
+	const size_t sample_total = (size_t)((bit_shift + bit_count + 7) >> 3);
+	const uint8_t line_mask = (uint8_t)(0xFFU << ((8 - (bit_count & 7)) & 7));
+	const uint8_t* pixel_data = g_pixels + (bit_start >> 3) + (in_y * g_length);
+	for (int pixel_y = 0; pixel_y < in_height; pixel_y++, pixel_data += g_length, out_pixels += line_size) {
+		if (!bit_shift) memcpy(out_pixels, pixel_data, line_size);
 		else {
-			if (pixel_y < 0) continue;
-			else if (pixel_y >= g_sheight) break;
-		};
-		for (int sample_x = 0; sample_x < g_pwidth; sample_x++) {
-			int pixel_x = in_x + sample_x;
-			if (in_hwrap) {
-				if (pixel_x >= g_cwidth) pixel_x %= g_cwidth;
-				if (pixel_x >= g_swidth) continue;
-			}
-			else {
-				if (pixel_x < 0) continue;
-				else if (pixel_x >= g_swidth) break;
+			for (size_t sample_index = 0U; sample_index < line_size; sample_index++) {
+				const uint8_t next_data = (sample_index + 1U) < sample_total ? pixel_data[sample_index + 1U] : 0U;
+				out_pixels[sample_index] = (uint8_t)((pixel_data[sample_index] << bit_shift) | (next_data >> (8 - bit_shift)));
 			};
-			uint8_t sample_data = pattern_data[((in_hflip ? (g_pwidth - 1) - sample_x : sample_x) >> 3) + ((in_vflip ? (g_pheight - 1) - sample_y : sample_y) * (g_pwidth >> 3))];
-			sample_data = (sample_data >> (in_hflip ? (sample_x & 7) : (7U - (sample_x & 7)))) & ((1U << 1U) - 1U); 
-			if (sample_data) {
-				sample_data = in_palette ? in_palette[sample_data] : sample_data;
-				const size_t pixel_index = (size_t)((pixel_x >> 3) + (pixel_y * g_length));
-				g_pixels[pixel_index] = (g_pixels[pixel_index] & (uint8_t)(~(1 << (7 - (pixel_x & 7))))) | ((sample_data & (uint8_t)(g_colours - 1)) << (7 - (pixel_x & 7)));
+		};
+		out_pixels[line_size - 1U] &= line_mask;
+	};
+};
+
+static void RGSWritePixelRows(int in_x, int in_y, int in_width, int in_height, const uint8_t* in_pixels) {
+	if (g_bits != g_depth) {
+		const size_t line_size = (size_t)(((in_width * g_depth) + 7) >> 3);
+		for (int pixel_y = 0; pixel_y < in_height; pixel_y++, in_pixels += line_size) RGSUnpackPixels(in_pixels, g_pixels + in_x + ((in_y + pixel_y) * g_length), in_width);
+		return;
+	};
+	const int bit_start = in_x * g_bits;
+	const int bit_shift = bit_start & 7;
+	const int bit_count = in_width * g_bits;
+	const size_t line_size = (size_t)((bit_count + 7) >> 3);
+	const uint8_t line_mask = (uint8_t)(0xFFU << ((8 - (bit_count & 7)) & 7));
+	uint8_t* pixel_data = g_pixels + (bit_start >> 3) + (in_y * g_length);
+	for (int pixel_y = 0; pixel_y < in_height; pixel_y++, pixel_data += g_length, in_pixels += line_size) {
+		if (!bit_shift) {
+			memcpy(pixel_data, in_pixels, line_size - 1U);
+			pixel_data[line_size - 1U] = (pixel_data[line_size - 1U] & (uint8_t)(~line_mask)) | (in_pixels[line_size - 1U] & line_mask);
+			continue;
+		};
+		for (size_t sample_index = 0U; sample_index < line_size; sample_index++) {
+			const uint8_t sample_mask = (sample_index + 1U) < line_size ? 0xFFU : line_mask;
+			const uint8_t sample_data = in_pixels[sample_index] & sample_mask;
+			const uint8_t spill_mask = (uint8_t)(sample_mask << (8 - bit_shift));
+			pixel_data[sample_index] = (pixel_data[sample_index] & (uint8_t)(~(sample_mask >> bit_shift))) | (uint8_t)(sample_data >> bit_shift);
+			if (spill_mask) pixel_data[sample_index + 1U] = (pixel_data[sample_index + 1U] & (uint8_t)(~spill_mask)) | (uint8_t)(sample_data << (8 - bit_shift));
+		};
+	};
+};
+
+
+static RGS_INLINE uint8_t RGSSpreadIndex(uint8_t in_index) { return (uint8_t)((in_index & (g_colours - 1)) * (0xFF / ((1 << g_bits) - 1))); };
+
+static RGS_INLINE void RGSFillPixelSpan(uint8_t* inout_line, int in_x, int in_count, uint8_t in_sample) {
+	const int bit_start = in_x * g_bits;
+	const int bit_end = (in_x + in_count) * g_bits;
+	const uint8_t start_mask = (uint8_t)(0xFFU >> (bit_start & 7));
+	const uint8_t end_mask = (uint8_t)(~(0xFFU >> (bit_end & 7)));
+	int sample_start = bit_start >> 3;
+	const int sample_end = bit_end >> 3;
+	if (sample_start == sample_end) {
+		inout_line[sample_start] = (inout_line[sample_start] & (uint8_t)(~(start_mask & end_mask))) | (in_sample & start_mask & end_mask);
+		return;
+	};
+	if (bit_start & 7) {
+		inout_line[sample_start] = (inout_line[sample_start] & (uint8_t)(~start_mask)) | (in_sample & start_mask);
+		sample_start++;
+	};
+	if (sample_end - sample_start < 16) {
+		for (int sample_index = sample_start; sample_index < sample_end; sample_index++) inout_line[sample_index] = in_sample;
+	}
+	else memset((void*)(inout_line + sample_start), in_sample, (size_t)(sample_end - sample_start));
+	if (bit_end & 7) inout_line[sample_end] = (inout_line[sample_end] & (uint8_t)(~end_mask)) | (in_sample & end_mask);
+};
+
+static RGS_INLINE void RGSFillPixelRun(int in_x, int in_y, int in_count, uint8_t in_sample) {
+	if (g_dback) RGSMarkDirty(in_x, in_y, in_count, 1);
+	RGSFillPixelSpan(g_pixels + (in_y * g_length), in_x, in_count, in_sample);
+};
+
+static void RGSFillRectangle(int64_t in_x, int64_t in_y, int64_t in_width, int64_t in_height, uint8_t in_index, int in_top, int in_bottom) {
+	const int pixel_left = in_x > 0 ? (int)(in_x) : 0;
+	const int pixel_right = in_x + in_width < g_swidth ? (int)(in_x + in_width) : g_swidth;
+	const int pixel_top = in_y > in_top ? (int)(in_y) : in_top;
+	const int pixel_bottom = in_y + in_height < in_bottom ? (int)(in_y + in_height) : in_bottom;
+	if (pixel_left >= pixel_right || pixel_top >= pixel_bottom) return;
+	const uint8_t sample_data = RGSSpreadIndex(in_index);
+	if (g_dback) RGSMarkDirty(pixel_left, pixel_top, pixel_right - pixel_left, pixel_bottom - pixel_top);
+	uint8_t* line_data = g_pixels + (pixel_top * g_length);
+	if (pixel_left == 0 && pixel_right == g_swidth && (g_length << 3) == g_swidth * g_bits) {
+		RGSFillPixelSpan(line_data, 0, (g_swidth * (pixel_bottom - pixel_top)), sample_data);
+		return;
+	};
+	for (int pixel_y = pixel_top; pixel_y < pixel_bottom; pixel_y++, line_data += g_length) RGSFillPixelSpan(line_data, pixel_left, pixel_right - pixel_left, sample_data);
+};
+
+static RGS_INLINE RGSLineStep RGSStartLine(int64_t in_start, int64_t in_offset, int64_t in_minor, int64_t in_major) {
+	RGSLineStep line_step;
+	const int64_t line_numerator = (in_offset * in_minor * 2) + in_major;
+	line_step.limit = in_major * 2;
+	line_step.position = line_numerator >= 0 ? line_numerator / line_step.limit : -(((-line_numerator) + line_step.limit - 1) / line_step.limit);
+	line_step.remainder = line_numerator - (line_step.position * line_step.limit);
+	line_step.position += in_start;
+	line_step.step = in_minor * 2;
+	return line_step;
+};
+
+static RGS_INLINE void RGSAdvanceLine(RGSLineStep* inout_line) {
+	inout_line->remainder += inout_line->step;
+	if (inout_line->remainder >= inout_line->limit) {
+		inout_line->remainder -= inout_line->limit;
+		inout_line->position++;
+	}
+	else if (inout_line->remainder < 0) {
+		inout_line->remainder += inout_line->limit;
+		inout_line->position--;
+	};
+};
+
+static void RGSDrawLineSpans(int in_start_x, int in_start_y, int in_end_x, int in_end_y, uint8_t in_index, int in_top, int in_bottom) {
+	const uint8_t sample_data = RGSSpreadIndex(in_index);
+	int64_t delta_x = (int64_t)(in_end_x) - in_start_x;
+	int64_t delta_y = (int64_t)(in_end_y) - in_start_y;
+	if ((delta_x < 0 ? -delta_x : delta_x) >= (delta_y < 0 ? -delta_y : delta_y)) {
+		const int64_t start_x = delta_x < 0 ? in_end_x : in_start_x;
+		const int64_t start_y = delta_x < 0 ? in_end_y : in_start_y;
+		if (delta_x < 0) {
+			delta_x = -delta_x;
+			delta_y = -delta_y;
+		};
+		const int64_t column_start = start_x > 0 ? start_x : 0;
+		const int64_t column_end = start_x + delta_x < g_swidth ? start_x + delta_x + 1 : g_swidth;
+		if (column_start >= column_end) return;
+		if (!delta_y) {
+			if (start_y >= in_top && start_y < in_bottom) RGSFillPixelRun((int)(column_start), (int)(start_y), (int)(column_end - column_start), sample_data);
+			return;
+		};
+		RGSLineStep line_step = RGSStartLine(start_y, column_start - start_x, delta_y, delta_x);
+		int64_t run_x = column_start;
+		int64_t run_y = line_step.position;
+		for (int64_t column_x = column_start + 1; column_x <= column_end; column_x++) {
+			if (column_x < column_end) {
+				RGSAdvanceLine(&line_step);
+				if (line_step.position == run_y) continue;
 			};
+			if (run_y >= in_top && run_y < in_bottom) RGSFillPixelRun((int)(run_x), (int)(run_y), (int)(column_x - run_x), sample_data);
+			run_x = column_x;
+			run_y = line_step.position;
 		};
+		return;
+	};
+	const int64_t start_x = delta_y < 0 ? in_end_x : in_start_x;
+	const int64_t start_y = delta_y < 0 ? in_end_y : in_start_y;
+	if (delta_y < 0) {
+		delta_x = -delta_x;
+		delta_y = -delta_y;
+	};
+	const int64_t row_start = start_y > in_top ? start_y : in_top;
+	const int64_t row_end = start_y + delta_y < in_bottom ? start_y + delta_y + 1 : in_bottom;
+	if (row_start >= row_end) return;
+	RGSLineStep line_step = RGSStartLine(start_x, row_start - start_y, delta_x, delta_y);
+	for (int64_t row_y = row_start; row_y < row_end; row_y++, RGSAdvanceLine(&line_step)) {
+		if (line_step.position >= 0 && line_step.position < g_swidth) RGSFillPixelRun((int)(line_step.position), (int)(row_y), 1, sample_data);
 	};
 };
 
-static void RGSDrawSprite4(int in_x, int in_y, RGSPattern in_pattern, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap) {
-	if (in_hwrap) in_x = in_x >= 0 ? (in_x % g_cwidth) : (g_cwidth + (in_x % g_cwidth));
-	if (in_vwrap) in_y = in_y >= 0 ? (in_y % g_cheight) : (g_cheight + (in_y % g_cheight));
-	const uint8_t* pattern_data = g_pdata + (((g_pwidth >> 1) * g_pheight) * (size_t)(in_pattern % g_pcount));
-	for (int sample_y = 0; sample_y < g_pheight; sample_y++) {
-		int pixel_y = in_y + sample_y;
-		if (in_vwrap) {
-			if (pixel_y >= g_cheight) pixel_y %= g_cheight;
-			if (pixel_y >= g_sheight) continue;
+static void RGSFillCircleSpans(int in_x, int in_y, int in_radius, uint8_t in_index, int in_top, int in_bottom) {
+	if (in_radius < 0) return;
+	const uint8_t sample_data = RGSSpreadIndex(in_index);
+	const int64_t circle_radius = in_radius;
+	const int64_t row_start = in_y - circle_radius > in_top ? in_y - circle_radius : in_top;
+	const int64_t row_end = in_y + circle_radius < in_bottom ? in_y + circle_radius + 1 : in_bottom;
+	for (int64_t row_y = row_start; row_y < row_end; row_y++) {
+		const int64_t span_limit = (circle_radius * circle_radius) + circle_radius - ((row_y - in_y) * (row_y - in_y));
+		int64_t span_half = (int64_t)(sqrt((double)(span_limit)));
+		while (span_half * span_half > span_limit) span_half--;
+		while ((span_half + 1) * (span_half + 1) <= span_limit) span_half++;
+		const int64_t span_left = in_x - span_half > 0 ? in_x - span_half : 0;
+		const int64_t span_right = in_x + span_half < g_swidth ? in_x + span_half + 1 : g_swidth;
+		if (span_left < span_right) RGSFillPixelRun((int)(span_left), (int)(row_y), (int)(span_right - span_left), sample_data);
+	};
+};
+
+
+typedef void(*RGSTileSpan)(int, int, int, int, int, RGSTile, const RGSPalette*, bool, int, int);
+
+static RGS_INLINE uint64_t RGSLoadSamples(const uint8_t* in_line, int in_size, int in_bit) {
+	const uint8_t* const sample_pointer = in_line + (in_bit >> 3);
+	const int sample_total = in_size - (in_bit >> 3);
+	uint64_t sample_data = 0U;
+	for (int byte_index = 0; byte_index < 8 && byte_index < sample_total; byte_index++) sample_data |= (uint64_t)(sample_pointer[byte_index]) << (56 - (byte_index << 3));
+	if (in_bit & 7) {
+		sample_data <<= in_bit & 7;
+		if (sample_total > 8) sample_data |= (uint64_t)(sample_pointer[8] >> (8 - (in_bit & 7)));
+	};
+	return sample_data;
+};
+
+static RGS_INLINE uint64_t RGSReverseSamples(uint64_t in_samples, int in_bits) {
+	in_samples = ((in_samples >> 32U) & 0x00000000FFFFFFFFULL) | ((in_samples & 0x00000000FFFFFFFFULL) << 32U);
+	in_samples = ((in_samples >> 16U) & 0x0000FFFF0000FFFFULL) | ((in_samples & 0x0000FFFF0000FFFFULL) << 16U);
+	in_samples = ((in_samples >> 8U) & 0x00FF00FF00FF00FFULL) | ((in_samples & 0x00FF00FF00FF00FFULL) << 8U);
+	if (in_bits < 8) in_samples = ((in_samples >> 4U) & 0x0F0F0F0F0F0F0F0FULL) | ((in_samples & 0x0F0F0F0F0F0F0F0FULL) << 4U);
+	if (in_bits < 4) in_samples = ((in_samples >> 2U) & 0x3333333333333333ULL) | ((in_samples & 0x3333333333333333ULL) << 2U);
+	if (in_bits < 2) in_samples = ((in_samples >> 1U) & 0x5555555555555555ULL) | ((in_samples & 0x5555555555555555ULL) << 1U);
+	return in_samples;
+};
+
+static RGS_INLINE uint64_t RGSOpaqueSamples(uint64_t in_samples, int in_bits) {
+	switch (in_bits) {
+	case 1: return in_samples;
+	case 2: return ((in_samples | (in_samples >> 1U)) & 0x5555555555555555ULL) * 0x3U;
+	default: return ((in_samples | (in_samples >> 1U) | (in_samples >> 2U) | (in_samples >> 3U)) & 0x1111111111111111ULL) * 0xFU;
+	};
+};
+
+static RGS_INLINE uint64_t RGSRemapSamples(uint64_t in_samples, RGSPalette in_palette, int in_bits) {
+	switch (in_bits) {
+	case 1: return ((in_palette[0] & 1U) ? ~in_samples : 0U) | ((in_palette[1] & 1U) ? in_samples : 0U);
+	case 2: {
+		const uint64_t high_lanes = (in_samples >> 1U) & 0x5555555555555555ULL;
+		const uint64_t low_lanes = in_samples & 0x5555555555555555ULL;
+		uint64_t sample_data = (((~high_lanes & ~low_lanes) & 0x5555555555555555ULL) * 3U) & (0x5555555555555555ULL * (in_palette[0] & 3U));
+		sample_data |= ((~high_lanes & low_lanes) * 3U) & (0x5555555555555555ULL * (in_palette[1] & 3U));
+		sample_data |= ((high_lanes & ~low_lanes) * 3U) & (0x5555555555555555ULL * (in_palette[2] & 3U));
+		return sample_data | (((high_lanes & low_lanes) * 3U) & (0x5555555555555555ULL * (in_palette[3] & 3U)));
+	};
+	default: {
+		uint64_t sample_data = 0U;
+		for (int sample_shift = 0; sample_shift < 64; sample_shift += 4) sample_data |= (uint64_t)(in_palette[(in_samples >> sample_shift) & 0xFU] & 0xFU) << sample_shift;
+		return sample_data;
+	};
+	};
+};
+
+static RGS_INLINE void RGSMergeSamples(uint8_t* inout_pixels, int in_shift, int in_size, uint64_t in_samples, uint64_t in_mask) {
+	const uint64_t pixel_data = in_samples >> in_shift;
+	const uint64_t pixel_mask = in_mask >> in_shift;
+	const int pixel_total = (in_shift + in_size + 7) >> 3;
+	for (int pixel_index = 0; pixel_index < pixel_total; pixel_index++, inout_pixels++) {
+		const uint8_t mask_byte = pixel_index < 8 ? (uint8_t)(pixel_mask >> (56 - (pixel_index << 3))) : (uint8_t)(in_mask << (8 - in_shift));
+		const uint8_t data_byte = pixel_index < 8 ? (uint8_t)(pixel_data >> (56 - (pixel_index << 3))) : (uint8_t)(in_samples << (8 - in_shift));
+		*inout_pixels = (*inout_pixels & (uint8_t)(~mask_byte)) | (data_byte & mask_byte);
+	};
+};
+
+static RGS_INLINE uint64_t RGSBlendSamples(uint64_t in_samples, uint64_t in_pixels, int in_bits, int in_count) {
+	const uint64_t lane_mask = (1ULL << in_bits) - 1U;
+	uint64_t sample_data = 0U;
+	for (int lane_shift = 64 - in_bits; lane_shift >= 64 - (in_count * in_bits); lane_shift -= in_bits) {
+		sample_data |= (uint64_t)(g_mdata[(((in_samples >> lane_shift) & lane_mask) << in_bits) | ((in_pixels >> lane_shift) & lane_mask)]) << lane_shift;
+	};
+	return sample_data;
+};
+
+static RGS_INLINE void RGSDrawPackedSpan(int in_pixel_x, int in_pixel_y, int in_sample_x, int in_sample_y, int in_count, RGSTile in_tile, const RGSPalette* in_palettes, bool in_transparent, int in_bits, int in_width, int in_height) {
+	const int line_size = (in_width * in_bits) >> 3;
+	const uint8_t* pattern_data = RGSResolvePattern(&in_tile, line_size * in_height);
+	pattern_data += (in_tile.vflip ? (in_height - 1) - in_sample_y : in_sample_y) * line_size;
+	const RGSPalette palette_data = in_palettes ? in_palettes[in_tile.palette] : RGS_NULL;
+	uint8_t* const pixel_data = g_pixels + (in_pixel_y * g_length);
+	const int lane_total = 64 / in_bits;
+	for (int sample_x = in_sample_x, pixel_x = in_pixel_x, sample_count = in_count; sample_count > 0;) {
+		const int lane_count = sample_count < lane_total ? sample_count : lane_total;
+		uint64_t sample_data;
+		if (in_tile.hflip) sample_data = RGSReverseSamples(RGSLoadSamples(pattern_data, line_size, (in_width - sample_x - lane_count) * in_bits), in_bits) << ((lane_total - lane_count) * in_bits);
+		else sample_data = RGSLoadSamples(pattern_data, line_size, sample_x * in_bits);
+		uint64_t sample_mask = ~0ULL << (64 - (lane_count * in_bits));
+		if (in_transparent) sample_mask &= RGSOpaqueSamples(sample_data, in_bits);
+		if (palette_data) sample_data = RGSRemapSamples(sample_data, palette_data, in_bits);
+		if (g_mdata) sample_data = RGSBlendSamples(sample_data, RGSLoadSamples(pixel_data, g_length, pixel_x * in_bits), in_bits, lane_count);
+		RGSMergeSamples(pixel_data + ((pixel_x * in_bits) >> 3), (pixel_x * in_bits) & 7, lane_count * in_bits, sample_data, sample_mask);
+		sample_x += lane_count;
+		pixel_x += lane_count;
+		sample_count -= lane_count;
+	};
+};
+
+static RGS_INLINE void RGSDrawTileSpan1(int in_pixel_x, int in_pixel_y, int in_sample_x, int in_sample_y, int in_count, RGSTile in_tile, const RGSPalette* in_palettes, bool in_transparent, int in_width, int in_height) {
+	RGSDrawPackedSpan(in_pixel_x, in_pixel_y, in_sample_x, in_sample_y, in_count, in_tile, in_palettes, in_transparent, 1, in_width, in_height);
+};
+
+static RGS_INLINE void RGSDrawTileSpan2(int in_pixel_x, int in_pixel_y, int in_sample_x, int in_sample_y, int in_count, RGSTile in_tile, const RGSPalette* in_palettes, bool in_transparent, int in_width, int in_height) {
+	RGSDrawPackedSpan(in_pixel_x, in_pixel_y, in_sample_x, in_sample_y, in_count, in_tile, in_palettes, in_transparent, 2, in_width, in_height);
+};
+
+static RGS_INLINE void RGSDrawTileSpan4(int in_pixel_x, int in_pixel_y, int in_sample_x, int in_sample_y, int in_count, RGSTile in_tile, const RGSPalette* in_palettes, bool in_transparent, int in_width, int in_height) {
+	RGSDrawPackedSpan(in_pixel_x, in_pixel_y, in_sample_x, in_sample_y, in_count, in_tile, in_palettes, in_transparent, 4, in_width, in_height);
+};
+
+static RGS_INLINE const uint8_t* RGSTileSamples8(int in_sample_x, int in_sample_y, RGSTile* inout_tile, int in_width, int in_height) {
+	const uint8_t* pattern_data = RGSResolvePattern(inout_tile, in_width * in_height);
+	pattern_data += (inout_tile->vflip ? (in_height - 1) - in_sample_y : in_sample_y) * in_width;
+	return pattern_data + (inout_tile->hflip ? (in_width - 1) - in_sample_x : in_sample_x);
+};
+
+static RGS_INLINE void RGSCopySamples8(uint8_t* out_pixels, const uint8_t* in_samples, int in_count, bool in_hflip, RGSPalette in_palette, bool in_transparent) {
+	const uint8_t* const pixel_end = out_pixels + in_count;
+	if (in_hflip) {
+		if (in_palette) {
+			if (in_transparent) do { const uint8_t sample_data = *(in_samples--); if (sample_data) *out_pixels = in_palette[sample_data]; } while (++out_pixels < pixel_end);
+			else do *out_pixels = in_palette[*(in_samples--)]; while (++out_pixels < pixel_end);
 		}
 		else {
-			if (pixel_y < 0) continue;
-			else if (pixel_y >= g_sheight) break;
-		};
-		for (int sample_x = 0; sample_x < g_pwidth; sample_x++) {
-			int pixel_x = in_x + sample_x;
-			if (in_hwrap) {
-				if (pixel_x >= g_cwidth) pixel_x %= g_cwidth;
-				if (pixel_x >= g_swidth) continue;
-			}
-			else {
-				if (pixel_x < 0) continue;
-				else if (pixel_x >= g_swidth) break;
-			};
-			uint8_t sample_data = pattern_data[((in_hflip ? (g_pwidth - 1) - sample_x : sample_x) >> 1) + ((in_vflip ? (g_pheight - 1) - sample_y : sample_y) * (g_pwidth >> 1))];
-			sample_data = (((sample_x + in_hflip) & 1) ? sample_data : (sample_data >> 4U)) & ((1U << 4U) - 1U);
-			if (sample_data) {
-				sample_data = in_palette ? in_palette[sample_data] : sample_data;
-				const size_t pixel_index = (size_t)((pixel_x >> 1) + (pixel_y * g_length));
-				if (pixel_x & 1) g_pixels[pixel_index] = (g_pixels[pixel_index] & 0b11110000U) | sample_data;
-				else g_pixels[pixel_index] = (g_pixels[pixel_index] & 0b00001111U) | (sample_data << 4U);
-			};
+			if (in_transparent) do { const uint8_t sample_data = *(in_samples--); if (sample_data) *out_pixels = sample_data; } while (++out_pixels < pixel_end);
+			else do *out_pixels = *(in_samples--); while (++out_pixels < pixel_end);
+		};
+	}
+	else {
+		if (in_palette) {
+			if (in_transparent) do { const uint8_t sample_data = *(in_samples++); if (sample_data) *out_pixels = in_palette[sample_data]; } while (++out_pixels < pixel_end);
+			else do *out_pixels = in_palette[*(in_samples++)]; while (++out_pixels < pixel_end);
+		}
+		else {
+			if (in_transparent) do { const uint8_t sample_data = *(in_samples++); if (sample_data) *out_pixels = sample_data; } while (++out_pixels < pixel_end);
+			else memcpy(out_pixels, in_samples, (size_t)(in_count));
 		};
 	};
 };
 
-static void RGSDrawSprite8(int in_x, int in_y, RGSPattern in_pattern, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap) {
-	if (in_hwrap) in_x = in_x >= 0 ? (in_x % g_cwidth) : (g_cwidth + (in_x % g_cwidth));
-	if (in_vwrap) in_y = in_y >= 0 ? (in_y % g_cheight) : (g_cheight + (in_y % g_cheight));
-	const uint8_t* pattern_data = g_pdata + ((g_pwidth * g_pheight) * (size_t)(in_pattern % g_pcount));
-	for (int sample_y = 0; sample_y < g_pheight; sample_y++) {
-		int pixel_y = in_y + sample_y;
-		if (in_vwrap) {
-			if (pixel_y >= g_cheight) pixel_y %= g_cheight;
-			if (pixel_y >= g_sheight) continue;
+static RGS_INLINE void RGSBlendSamples8(uint8_t* inout_pixels, const uint8_t* in_samples, int in_count, bool in_hflip, RGSPalette in_palette, bool in_keyed, uint8_t in_key) {
+	const uint8_t* const blend_data = g_mdata;
+	const uint8_t colour_mask = (uint8_t)(g_colours - 1);
+	const int colour_shift = g_depth;
+	const int sample_step = in_hflip ? -1 : 1;
+	const int key_data = in_keyed ? (int)(in_key) : -1;
+	for (int sample_index = 0; sample_index < in_count; sample_index++, in_samples += sample_step) {
+		const uint8_t sample_data = *in_samples;
+		const uint8_t pixel_data = inout_pixels[sample_index];
+		const uint8_t colour_index = (in_palette ? in_palette[sample_data] : sample_data) & colour_mask;
+		const uint8_t blend_colour = blend_data[((size_t)(colour_index) << colour_shift) | (pixel_data & colour_mask)];
+		inout_pixels[sample_index] = (sample_data == key_data) ? pixel_data : blend_colour;
+	};
+};
+
+#if RGS_GRAPHICS_SIMD
+static RGS_INLINE __m128i RGSReverseSamples16SSE2(__m128i in_samples) {
+	in_samples = _mm_or_si128(_mm_slli_epi16(in_samples, 8), _mm_srli_epi16(in_samples, 8));
+	in_samples = _mm_shufflehi_epi16(_mm_shufflelo_epi16(in_samples, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+	return _mm_shuffle_epi32(in_samples, _MM_SHUFFLE(1, 0, 3, 2));
+};
+
+static RGS_INLINE __m128i RGSReverseSamples8SSE2(__m128i in_samples) {
+	in_samples = _mm_or_si128(_mm_slli_epi16(in_samples, 8), _mm_srli_epi16(in_samples, 8));
+	return _mm_shufflelo_epi16(in_samples, _MM_SHUFFLE(0, 1, 2, 3));
+};
+
+static RGS_INLINE __m128i RGSRemapSamplesSSE2(__m128i in_samples, int in_count, RGSPalette in_palette) {
+	uint8_t sample_data[16];
+	_mm_storeu_si128((__m128i*)(sample_data), in_samples);
+	for (int sample_index = 0; sample_index < in_count; sample_index++) sample_data[sample_index] = in_palette[sample_data[sample_index]];
+	return _mm_loadu_si128((const __m128i*)(sample_data));
+};
+
+static RGS_INLINE void RGSCopySamples8SSE2(uint8_t* out_pixels, const uint8_t* in_samples, int in_count, bool in_hflip, RGSPalette in_palette, bool in_transparent) {
+	if (!in_hflip && !in_palette && !in_transparent) {
+		memcpy(out_pixels, in_samples, (size_t)(in_count));
+		return;
+	};
+	for (; in_count >= 16; in_count -= 16, out_pixels += 16) {
+		__m128i sample_data;
+		if (in_hflip) {
+			sample_data = RGSReverseSamples16SSE2(_mm_loadu_si128((const __m128i*)(in_samples - 15)));
+			in_samples -= 16;
 		}
 		else {
-			if (pixel_y < 0) continue;
-			else if (pixel_y >= g_sheight) break;
-		};
-		for (int sample_x = 0; sample_x < g_pwidth; sample_x++) {
-			int pixel_x = in_x + sample_x;
-			if (in_hwrap) {
-				if (pixel_x >= g_cwidth) pixel_x %= g_cwidth;
-				if (pixel_x >= g_swidth) continue;
-			}
-			else {
-				if (pixel_x < 0) continue;
-				else if (pixel_x >= g_swidth) break;
-			};
-			const uint8_t sample_data = pattern_data[(in_hflip ? (g_pwidth - 1) - sample_x : sample_x) + ((in_vflip ? (g_pheight - 1) - sample_y : sample_y) * g_pwidth)];
-			if (sample_data) g_pixels[pixel_x + (pixel_y * g_length)] = in_palette ? in_palette[sample_data] : sample_data;
+			sample_data = _mm_loadu_si128((const __m128i*)(in_samples));
+			in_samples += 16;
 		};
+		__m128i pixel_data = in_palette ? RGSRemapSamplesSSE2(sample_data, 16, in_palette) : sample_data;
+		if (in_transparent) {
+			const __m128i pixel_mask = _mm_cmpeq_epi8(sample_data, _mm_setzero_si128());
+			pixel_data = _mm_or_si128(_mm_and_si128(pixel_mask, _mm_loadu_si128((const __m128i*)(out_pixels))), _mm_andnot_si128(pixel_mask, pixel_data));
+		};
+		_mm_storeu_si128((__m128i*)(out_pixels), pixel_data);
+	};
+	if (in_count >= 8) {
+		__m128i sample_data;
+		if (in_hflip) {
+			sample_data = RGSReverseSamples8SSE2(_mm_loadl_epi64((const __m128i*)(in_samples - 7)));
+			in_samples -= 8;
+		}
+		else {
+			sample_data = _mm_loadl_epi64((const __m128i*)(in_samples));
+			in_samples += 8;
+		};
+		__m128i pixel_data = in_palette ? RGSRemapSamplesSSE2(sample_data, 8, in_palette) : sample_data;
+		if (in_transparent) {
+			const __m128i pixel_mask = _mm_cmpeq_epi8(sample_data, _mm_setzero_si128());
+			pixel_data = _mm_or_si128(_mm_and_si128(pixel_mask, _mm_loadl_epi64((const __m128i*)(out_pixels))), _mm_andnot_si128(pixel_mask, pixel_data));
+		};
+		_mm_storel_epi64((__m128i*)(out_pixels), pixel_data);
+		in_count -= 8;
+		out_pixels += 8;
 	};
+	if (in_count > 0) RGSCopySamples8(out_pixels, in_samples, in_count, in_hflip, in_palette, in_transparent);
 };
 
-
-static void RGSDrawTiles1(int in_x, int in_y, const RGSTile* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent) {
-	if (in_hwrap) in_x = in_x >= 0 ? (in_x % g_cwidth) : (g_cwidth + (in_x % g_cwidth));
-	if (in_vwrap) in_y = in_y >= 0 ? (in_y % g_cheight) : (g_cheight + (in_y % g_cheight));
-	const int layer_x_end = in_x + g_cwidth;
-	const int layer_y_end = in_y + g_cheight;
-	int layer_y = in_y;
-	do {
-		int pixel_y = layer_y;
-		if (in_vwrap) {
-			if (pixel_y >= g_cheight) pixel_y %= g_cheight;
-			if (pixel_y >= g_sheight) continue;
+static RGS_INLINE void RGSBlendSamples8SSE2(uint8_t* inout_pixels, const uint8_t* in_samples, int in_count, bool in_hflip, RGSPalette in_palette, bool in_keyed, uint8_t in_key) {
+	const uint8_t* const blend_data = g_mdata;
+	const __m128i colour_mask = _mm_set1_epi8((char)(g_colours - 1));
+	const __m128i key_data = _mm_set1_epi8((char)(in_key));
+	const __m128i colour_shift = _mm_cvtsi32_si128(g_depth);
+	for (; in_count >= 16; in_count -= 16, inout_pixels += 16) {
+		__m128i sample_data;
+		if (in_hflip) {
+			sample_data = RGSReverseSamples16SSE2(_mm_loadu_si128((const __m128i*)(in_samples - 15)));
+			in_samples -= 16;
 		}
 		else {
-			if (pixel_y < 0) continue;
-			else if (pixel_y >= g_sheight) break;
+			sample_data = _mm_loadu_si128((const __m128i*)(in_samples));
+			in_samples += 16;
 		};
-		int tile_y = layer_y - in_y;
-		const int sample_y = tile_y & (g_pheight - 1);
-		tile_y /= g_pheight;
-		int layer_x = in_x;
-		do {
-			int pixel_x = layer_x;
-			if (in_hwrap) {
-				if (pixel_x >= g_cwidth) pixel_x %= g_cwidth;
-				if (pixel_x >= g_swidth) continue;
-			}
-			else {
-				if (pixel_x < 0) continue;
-				else if (pixel_x >= g_swidth) break;
-			};
-			int tile_x = layer_x - in_x;
-			const int sample_x = tile_x & (g_pwidth - 1);
-			tile_x /= g_pwidth;
-			const RGSTile tile_data = in_tiles[tile_x + (tile_y * ((g_cwidth + (g_pwidth - 1)) / g_pwidth))];
-			const uint8_t* pattern_data = g_pdata + (((g_pwidth >> 3) * g_pheight) * (size_t)(tile_data.pattern % g_pcount));
-			uint8_t sample_data = pattern_data[((tile_data.hflip ? (g_pwidth - 1) - sample_x : sample_x) >> 3) + ((tile_data.vflip ? (g_pheight - 1) - sample_y : sample_y) * (g_pwidth >> 3))];
-			sample_data = (sample_data >> (tile_data.hflip ? (sample_x & 7) : (7U - (sample_x & 7)))) & ((1U << 1U) - 1U); 
-			if (!in_transparent || sample_data) {
-				sample_data = (in_palettes && in_palettes[tile_data.palette]) ? in_palettes[tile_data.palette][sample_data] : sample_data;
-				const size_t pixel_index = (size_t)((pixel_x >> 3) + (pixel_y * g_length));
-				g_pixels[pixel_index] = (g_pixels[pixel_index] & (uint8_t)(~(1 << (7 - (pixel_x & 7))))) | ((sample_data & (uint8_t)(g_colours - 1)) << (7 - (pixel_x & 7)));
-			};
+		const __m128i pixel_data = _mm_loadu_si128((const __m128i*)(inout_pixels));
+		const __m128i colour_data = _mm_and_si128(in_palette ? RGSRemapSamplesSSE2(sample_data, 16, in_palette) : sample_data, colour_mask);
+		const __m128i target_data = _mm_and_si128(pixel_data, colour_mask);
+		uint16_t blend_indices[16];
+		_mm_storeu_si128((__m128i*)(blend_indices), _mm_or_si128(_mm_sll_epi16(_mm_unpacklo_epi8(colour_data, _mm_setzero_si128()), colour_shift), _mm_unpacklo_epi8(target_data, _mm_setzero_si128())));
+		_mm_storeu_si128((__m128i*)(blend_indices + 8), _mm_or_si128(_mm_sll_epi16(_mm_unpackhi_epi8(colour_data, _mm_setzero_si128()), colour_shift), _mm_unpackhi_epi8(target_data, _mm_setzero_si128())));
+		uint64_t blend_low = 0U, blend_high = 0U;
+		for (int sample_index = 0; sample_index < 8; sample_index++) {
+			blend_low |= (uint64_t)(blend_data[blend_indices[sample_index]]) << (sample_index << 3);
+			blend_high |= (uint64_t)(blend_data[blend_indices[sample_index + 8]]) << (sample_index << 3);
+		};
+		__m128i blend_pixels = _mm_set_epi64x((long long)(blend_high), (long long)(blend_low));
+		if (in_keyed) {
+			const __m128i key_mask = _mm_cmpeq_epi8(sample_data, key_data);
+			blend_pixels = _mm_or_si128(_mm_and_si128(key_mask, pixel_data), _mm_andnot_si128(key_mask, blend_pixels));
+		};
+		_mm_storeu_si128((__m128i*)(inout_pixels), blend_pixels);
+	};
+	if (in_count >= 8) {
+		__m128i sample_data;
+		if (in_hflip) {
+			sample_data = RGSReverseSamples8SSE2(_mm_loadl_epi64((const __m128i*)(in_samples - 7)));
+			in_samples -= 8;
 		}
-		while (++layer_x < layer_x_end);
-	}
-	while (++layer_y < layer_y_end);
+		else {
+			sample_data = _mm_loadl_epi64((const __m128i*)(in_samples));
+			in_samples += 8;
+		};
+		const __m128i pixel_data = _mm_loadl_epi64((const __m128i*)(inout_pixels));
+		const __m128i colour_data = _mm_and_si128(in_palette ? RGSRemapSamplesSSE2(sample_data, 8, in_palette) : sample_data, colour_mask);
+		const __m128i target_data = _mm_and_si128(pixel_data, colour_mask);
+		uint16_t blend_indices[8];
+		_mm_storeu_si128((__m128i*)(blend_indices), _mm_or_si128(_mm_sll_epi16(_mm_unpacklo_epi8(colour_data, _mm_setzero_si128()), colour_shift), _mm_unpacklo_epi8(target_data, _mm_setzero_si128())));
+		uint64_t blend_low = 0U;
+		for (int sample_index = 0; sample_index < 8; sample_index++) blend_low |= (uint64_t)(blend_data[blend_indices[sample_index]]) << (sample_index << 3);
+		__m128i blend_pixels = _mm_cvtsi64_si128((long long)(blend_low));
+		if (in_keyed) {
+			const __m128i key_mask = _mm_cmpeq_epi8(sample_data, key_data);
+			blend_pixels = _mm_or_si128(_mm_and_si128(key_mask, pixel_data), _mm_andnot_si128(key_mask, blend_pixels));
+		};
+		_mm_storel_epi64((__m128i*)(inout_pixels), blend_pixels);
+		in_count -= 8;
+		inout_pixels += 8;
+	};
+	if (in_count > 0) RGSBlendSamples8(inout_pixels, in_samples, in_count, in_hflip, in_palette, in_keyed, in_key);
 };
 
-static void RGSDrawTiles4(int in_x, int in_y, const RGSTile* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent) {
-	if (in_hwrap) in_x = in_x >= 0 ? (in_x % g_cwidth) : (g_cwidth + (in_x % g_cwidth));
-	if (in_vwrap) in_y = in_y >= 0 ? (in_y % g_cheight) : (g_cheight + (in_y % g_cheight));
-	const int layer_x_end = in_x + g_cwidth;
-	const int layer_y_end = in_y + g_cheight;
-	int layer_y = in_y;
-	do {
-		int pixel_y = layer_y;
-		if (in_vwrap) {
-			if (pixel_y >= g_cheight) pixel_y %= g_cheight;
-			if (pixel_y >= g_sheight) continue;
+static RGS_INLINE RGS_TARGET("avx2") void RGSCopySamples8AVX2(uint8_t* out_pixels, const uint8_t* in_samples, int in_count, bool in_hflip, RGSPalette in_palette, bool in_transparent) {
+	if (!in_hflip && !in_palette && !in_transparent) {
+		memcpy(out_pixels, in_samples, (size_t)(in_count));
+		return;
+	};
+	for (; in_count >= 32; in_count -= 32, out_pixels += 32) {
+		__m256i sample_data;
+		if (in_hflip) {
+			sample_data = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(in_samples - 31)), _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)), _MM_SHUFFLE(1, 0, 3, 2));
+			in_samples -= 32;
 		}
 		else {
-			if (pixel_y < 0) continue;
-			else if (pixel_y >= g_sheight) break;
+			sample_data = _mm256_loadu_si256((const __m256i*)(in_samples));
+			in_samples += 32;
 		};
-		int tile_y = layer_y - in_y;
-		const int sample_y = tile_y & (g_pheight - 1);
-		tile_y /= g_pheight;
-		int layer_x = in_x;
-		do {
-			int pixel_x = layer_x;
-			if (in_hwrap) {
-				if (pixel_x >= g_cwidth) pixel_x %= g_cwidth;
-				if (pixel_x >= g_swidth) continue;
-			}
-			else {
-				if (pixel_x < 0) continue;
-				else if (pixel_x >= g_swidth) break;
-			};
-			int tile_x = layer_x - in_x;
-			const int sample_x = tile_x & (g_pwidth - 1);
-			tile_x /= g_pwidth;
-			const RGSTile tile_data = in_tiles[tile_x + (tile_y * ((g_cwidth + (g_pwidth - 1)) / g_pwidth))];
-			const uint8_t* pattern_data = g_pdata + (((g_pwidth >> 1) * g_pheight) * (size_t)(tile_data.pattern % g_pcount));
-			uint8_t sample_data = pattern_data[((tile_data.hflip ? (g_pwidth - 1) - sample_x : sample_x) >> 1) + ((tile_data.vflip ? (g_pheight - 1) - sample_y : sample_y) * (g_pwidth >> 1))];
-			sample_data = (((sample_x + tile_data.hflip) & 1) ? sample_data : (sample_data >> 4U)) & ((1U << 4U) - 1U);
-			if (!in_transparent || sample_data) {
-				sample_data = (in_palettes && in_palettes[tile_data.palette]) ? in_palettes[tile_data.palette][sample_data] : sample_data;
-				const size_t pixel_index = (size_t)((pixel_x >> 1) + (pixel_y * g_length));
-				if (pixel_x & 1) g_pixels[pixel_index] = (g_pixels[pixel_index] & 0b11110000U) | sample_data;
-				else g_pixels[pixel_index] = (g_pixels[pixel_index] & 0b00001111U) | (sample_data << 4U);
-			};
+		__m256i pixel_data = sample_data;
+		if (in_palette) pixel_data = _mm256_set_m128i(RGSRemapSamplesSSE2(_mm256_extracti128_si256(sample_data, 1), 16, in_palette), RGSRemapSamplesSSE2(_mm256_castsi256_si128(sample_data), 16, in_palette));
+		if (in_transparent) pixel_data = _mm256_blendv_epi8(pixel_data, _mm256_loadu_si256((const __m256i*)(out_pixels)), _mm256_cmpeq_epi8(sample_data, _mm256_setzero_si256()));
+		_mm256_storeu_si256((__m256i*)(out_pixels), pixel_data);
+	};
+	if (in_count > 0) RGSCopySamples8SSE2(out_pixels, in_samples, in_count, in_hflip, in_palette, in_transparent);
+};
+
+static RGS_INLINE RGS_TARGET("avx2") void RGSShuffleSamples8AVX2(uint8_t* out_pixels, const uint8_t* in_samples, int in_count, bool in_hflip, RGSPalette in_palette, bool in_transparent) {
+	const __m128i palette_data = _mm_load_si128((const __m128i*)(in_palette));
+	for (; in_count >= 16; in_count -= 16, out_pixels += 16) {
+		__m128i sample_data;
+		if (in_hflip) {
+			sample_data = RGSReverseSamples16SSE2(_mm_loadu_si128((const __m128i*)(in_samples - 15)));
+			in_samples -= 16;
 		}
-		while (++layer_x < layer_x_end);
-	}
-	while (++layer_y < layer_y_end);
+		else {
+			sample_data = _mm_loadu_si128((const __m128i*)(in_samples));
+			in_samples += 16;
+		};
+		__m128i pixel_data = _mm_shuffle_epi8(palette_data, sample_data);
+		if (in_transparent) pixel_data = _mm_blendv_epi8(pixel_data, _mm_loadu_si128((const __m128i*)(out_pixels)), _mm_cmpeq_epi8(sample_data, _mm_setzero_si128()));
+		_mm_storeu_si128((__m128i*)(out_pixels), pixel_data);
+	};
+	if (in_count >= 8) {
+		__m128i sample_data;
+		if (in_hflip) {
+			sample_data = RGSReverseSamples8SSE2(_mm_loadl_epi64((const __m128i*)(in_samples - 7)));
+			in_samples -= 8;
+		}
+		else {
+			sample_data = _mm_loadl_epi64((const __m128i*)(in_samples));
+			in_samples += 8;
+		};
+		__m128i pixel_data = _mm_shuffle_epi8(palette_data, sample_data);
+		if (in_transparent) pixel_data = _mm_blendv_epi8(pixel_data, _mm_loadl_epi64((const __m128i*)(out_pixels)), _mm_cmpeq_epi8(sample_data, _mm_setzero_si128()));
+		_mm_storel_epi64((__m128i*)(out_pixels), pixel_data);
+		in_count -= 8;
+		out_pixels += 8;
+	};
+	if (in_count > 0) RGSCopySamples8(out_pixels, in_samples, in_count, in_hflip, in_palette, in_transparent);
+};
+#endif
+
+static RGS_INLINE void RGSDrawTileSpan8(int in_pixel_x, int in_pixel_y, int in_sample_x, int in_sample_y, int in_count, RGSTile in_tile, const RGSPalette* in_palettes, bool in_transparent, int in_width, int in_height) {
+	const uint8_t* const sample_data = RGSTileSamples8(in_sample_x, in_sample_y, &in_tile, in_width, in_height);
+	if (g_mdata) RGSBlendSamples8(g_pixels + in_pixel_x + (in_pixel_y * g_length), sample_data, in_count, in_tile.hflip, in_palettes ? in_palettes[in_tile.palette] : RGS_NULL, in_transparent, 0U);
+	else RGSCopySamples8(g_pixels + in_pixel_x + (in_pixel_y * g_length), sample_data, in_count, in_tile.hflip, in_palettes ? in_palettes[in_tile.palette] : RGS_NULL, in_transparent);
+};
+
+#if RGS_GRAPHICS_SIMD
+static RGS_INLINE void RGSDrawTileSpan8SSE2(int in_pixel_x, int in_pixel_y, int in_sample_x, int in_sample_y, int in_count, RGSTile in_tile, const RGSPalette* in_palettes, bool in_transparent, int in_width, int in_height) {
+	const uint8_t* const sample_data = RGSTileSamples8(in_sample_x, in_sample_y, &in_tile, in_width, in_height);
+	if (g_mdata) RGSBlendSamples8SSE2(g_pixels + in_pixel_x + (in_pixel_y * g_length), sample_data, in_count, in_tile.hflip, in_palettes ? in_palettes[in_tile.palette] : RGS_NULL, in_transparent, 0U);
+	else RGSCopySamples8SSE2(g_pixels + in_pixel_x + (in_pixel_y * g_length), sample_data, in_count, in_tile.hflip, in_palettes ? in_palettes[in_tile.palette] : RGS_NULL, in_transparent);
+};
+
+static RGS_INLINE RGS_TARGET("avx2") void RGSDrawTileSpan8AVX2(int in_pixel_x, int in_pixel_y, int in_sample_x, int in_sample_y, int in_count, RGSTile in_tile, const RGSPalette* in_palettes, bool in_transparent, int in_width, int in_height) {
+	const uint8_t* const sample_data = RGSTileSamples8(in_sample_x, in_sample_y, &in_tile, in_width, in_height);
+	const RGSPalette palette_data = in_palettes ? in_palettes[in_tile.palette] : RGS_NULL;
+	if (g_mdata) RGSBlendSamples8SSE2(g_pixels + in_pixel_x + (in_pixel_y * g_length), sample_data, in_count, in_tile.hflip, palette_data, in_transparent, 0U);
+	else if (palette_data && g_colours <= 16 && RGSBankedPalette(palette_data)) RGSShuffleSamples8AVX2(g_pixels + in_pixel_x + (in_pixel_y * g_length), sample_data, in_count, in_tile.hflip, palette_data, in_transparent);
+	else RGSCopySamples8AVX2(g_pixels + in_pixel_x + (in_pixel_y * g_length), sample_data, in_count, in_tile.hflip, palette_data, in_transparent);
+};
+#endif
+
+static RGS_INLINE int RGSClipSegments(int in_position, int in_size, int in_screen, int in_canvas, bool in_wrap, int* out_pixels, int* out_samples, int* out_counts) {
+	int segment_total = 0;
+	if (in_wrap) {
+		const int pixel_end = (in_position + in_size) < in_canvas ? (in_position + in_size) : in_canvas;
+		if (in_position < in_screen) {
+			out_pixels[segment_total] = in_position;
+			out_samples[segment_total] = 0;
+			out_counts[segment_total++] = (pixel_end < in_screen ? pixel_end : in_screen) - in_position;
+		};
+		if (in_position + in_size > in_canvas) {
+			const int wrap_end = (in_position + in_size) - in_canvas;
+			out_pixels[segment_total] = 0;
+			out_samples[segment_total] = in_canvas - in_position;
+			out_counts[segment_total++] = wrap_end < in_screen ? wrap_end : in_screen;
+		};
+	}
+	else {
+		const int pixel_start = in_position > 0 ? in_position : 0;
+		const int pixel_end = (in_position + in_size) < in_screen ? (in_position + in_size) : in_screen;
+		if (pixel_start < pixel_end) {
+			out_pixels[segment_total] = pixel_start;
+			out_samples[segment_total] = pixel_start - in_position;
+			out_counts[segment_total++] = pixel_end - pixel_start;
+		};
+	};
+	return segment_total;
+};
+
+static RGS_INLINE int RGSClipBand(int in_top, int in_total, int* inout_pixels, int* inout_samples, int* inout_counts) {
+	int segment_total = 0;
+	for (int segment_index = 0; segment_index < in_total; segment_index++) {
+		const int segment_skip = in_top > inout_pixels[segment_index] ? in_top - inout_pixels[segment_index] : 0;
+		if (inout_counts[segment_index] <= segment_skip) continue;
+		inout_pixels[segment_total] = inout_pixels[segment_index] + segment_skip;
+		inout_samples[segment_total] = inout_samples[segment_index] + segment_skip;
+		inout_counts[segment_total++] = inout_counts[segment_index] - segment_skip;
+	};
+	return segment_total;
+};
+
+static RGS_INLINE void RGSDrawSpriteSpans(int in_x, int in_y, RGSPattern in_pattern, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap, int in_top, int in_bottom, RGSTileSpan in_span, int in_width, int in_height) {
+	if (in_hwrap) in_x = in_x >= 0 ? (in_x % g_cwidth) : (g_cwidth + (in_x % g_cwidth));
+	if (in_vwrap) in_y = in_y >= 0 ? (in_y % g_cheight) : (g_cheight + (in_y % g_cheight));
+	int column_x[2], column_sample[2], column_count[2];
+	const int column_total = RGSClipSegments(in_x, in_width, g_swidth, g_cwidth, in_hwrap, column_x, column_sample, column_count);
+	if (!column_total) return;
+	int row_y[2], row_sample[2], row_count[2];
+	int row_total = RGSClipSegments(in_y, in_height, in_bottom, g_cheight, in_vwrap, row_y, row_sample, row_count);
+	if (in_top) row_total = RGSClipBand(in_top, row_total, row_y, row_sample, row_count);
+	if (!row_total) return;
+	if (g_dback) RGSMarkDirtySegments(column_x, column_count, column_total, row_y, row_count, row_total);
+	const RGSTile sprite_tile = { in_pattern, 0U, in_hflip, in_vflip };
+	const RGSPalette* const sprite_palettes = in_palette ? &in_palette : RGS_NULL;
+	for (int row_index = 0; row_index < row_total; row_index++) {
+		for (int row_offset = 0; row_offset < row_count[row_index]; row_offset++) {
+			for (int column_index = 0; column_index < column_total; column_index++) in_span(column_x[column_index], row_y[row_index] + row_offset, column_sample[column_index], row_sample[row_index] + row_offset, column_count[column_index], sprite_tile, sprite_palettes, true, in_width, in_height);
+		};
+	};
+};
+
+static RGS_INLINE bool RGSSpriteVisible(const RGSSpriteDesc* in_sprite, int in_top, int in_bottom, int in_width, int in_height) {
+	int sprite_x = in_sprite->x;
+	if (in_sprite->hwrap) {
+		if (sprite_x < 0 || sprite_x >= g_cwidth) sprite_x = sprite_x >= 0 ? (sprite_x % g_cwidth) : (g_cwidth + (sprite_x % g_cwidth));
+		if (sprite_x >= g_swidth && sprite_x + in_width <= g_cwidth) return false;
+	}
+	else if (sprite_x >= g_swidth || sprite_x + in_width <= 0) return false;
+	int sprite_y = in_sprite->y;
+	if (in_sprite->vwrap) {
+		if (sprite_y < 0 || sprite_y >= g_cheight) sprite_y = sprite_y >= 0 ? (sprite_y % g_cheight) : (g_cheight + (sprite_y % g_cheight));
+		if ((sprite_y >= in_bottom || sprite_y + in_height <= in_top) && sprite_y + in_height <= g_cheight + in_top) return false;
+	}
+	else if (sprite_y >= in_bottom || sprite_y + in_height <= in_top) return false;
+	return true;
+};
+
+static bool RGSClaimSpriteCells(const RGSSpriteDesc* in_sprite) {
+	const int sprite_x = in_sprite->hwrap ? (in_sprite->x >= 0 ? (in_sprite->x % g_cwidth) : (g_cwidth + (in_sprite->x % g_cwidth))) : in_sprite->x;
+	const int sprite_y = in_sprite->vwrap ? (in_sprite->y >= 0 ? (in_sprite->y % g_cheight) : (g_cheight + (in_sprite->y % g_cheight))) : in_sprite->y;
+	int column_x[2], column_sample[2], column_count[2];
+	const int column_total = RGSClipSegments(sprite_x, g_pwidth, g_swidth, g_cwidth, in_sprite->hwrap, column_x, column_sample, column_count);
+	int row_y[2], row_sample[2], row_count[2];
+	const int row_total = RGSClipSegments(sprite_y, g_pheight, g_sheight, g_cheight, in_sprite->vwrap, row_y, row_sample, row_count);
+	const int cell_stride = g_swidth / g_pwidth;
+	for (int pass_index = 0; pass_index < 2; pass_index++) {
+		for (int row_index = 0; row_index < row_total; row_index++) {
+			for (int cell_y = row_y[row_index] / g_pheight; cell_y <= ((row_y[row_index] + row_count[row_index]) - 1) / g_pheight; cell_y++) {
+				for (int column_index = 0; column_index < column_total; column_index++) {
+					for (int cell_x = column_x[column_index] / g_pwidth; cell_x <= ((column_x[column_index] + column_count[column_index]) - 1) / g_pwidth; cell_x++) {
+						uint32_t* const cell_data = g_scells + cell_x + (cell_y * cell_stride);
+						if (pass_index) *cell_data = g_sstamp;
+						else if (*cell_data == g_sstamp) return false;
+					};
+				};
+			};
+		};
+	};
+	return true;
+};
+
+static void RGSNextSpriteCells() {
+	if (++g_sstamp) return;
+	memset(g_scells, 0, (size_t)((g_swidth / g_pwidth) * (g_sheight / g_pheight)) * sizeof(*g_scells));
+	g_sstamp = 1U;
+};
+
+static int RGSCompareSpriteKeys(const void* in_left, const void* in_right) {
+	const uint64_t left_key = *(const uint64_t*)(in_left);
+	const uint64_t right_key = *(const uint64_t*)(in_right);
+	return left_key < right_key ? -1 : (left_key > right_key ? 1 : 0);
+};
+
+static RGS_INLINE void RGSDrawSortedSprites(const RGSSpriteDesc* in_sprites, size_t in_count, int in_top, int in_bottom, RGSTileSpan in_span, int in_width, int in_height) {
+	qsort(g_skeys, in_count, sizeof(*g_skeys), &RGSCompareSpriteKeys);
+	for (size_t key_index = 0U; key_index < in_count; key_index++) {
+		const RGSSpriteDesc* const sprite = in_sprites + (size_t)(g_skeys[key_index] & 0xFFFFFFFFULL);
+		RGSDrawSpriteSpans(sprite->x, sprite->y, sprite->pattern, sprite->palette, sprite->hflip, sprite->vflip, sprite->hwrap, sprite->vwrap, in_top, in_bottom, in_span, in_width, in_height);
+	};
+	RGSNextSpriteCells();
+};
+
+static RGS_INLINE void RGSDrawSpriteBatch(const RGSSpriteDesc* in_sprites, size_t in_count, bool in_sort, int in_top, int in_bottom, RGSTileSpan in_span, int in_width, int in_height) {
+	if (!in_sort) {
+		for (const RGSSpriteDesc* sprite = in_sprites; sprite < in_sprites + in_count; sprite++) {
+			if (RGSSpriteVisible(sprite, in_top, in_bottom, in_width, in_height)) RGSDrawSpriteSpans(sprite->x, sprite->y, sprite->pattern, sprite->palette, sprite->hflip, sprite->vflip, sprite->hwrap, sprite->vwrap, in_top, in_bottom, in_span, in_width, in_height);
+		};
+		return;
+	};
+	size_t key_total = 0U;
+	for (size_t sprite_index = 0U; sprite_index < in_count; sprite_index++) {
+		const RGSSpriteDesc* const sprite = in_sprites + sprite_index;
+		if (!RGSSpriteVisible(sprite, in_top, in_bottom, in_width, in_height)) continue;
+		if (!RGSClaimSpriteCells(sprite)) {
+			RGSDrawSortedSprites(in_sprites, key_total, in_top, in_bottom, in_span, in_width, in_height);
+			key_total = 0U;
+			RGSClaimSpriteCells(sprite);
+		};
+		g_skeys[key_total++] = ((uint64_t)(sprite->pattern) << 56U) | ((uint64_t)(((uintptr_t)(sprite->palette) >> 4U) & 0xFFFFFFU) << 32U) | (uint64_t)(sprite_index);
+	};
+	RGSDrawSortedSprites(in_sprites, key_total, in_top, in_bottom, in_span, in_width, in_height);
+};
+
+static RGS_INLINE bool RGSFetchTile(const uint8_t* in_data, bool in_packed, uint32_t in_priorities, RGSTile* out_tile) {
+	if (!in_packed) {
+		*out_tile = *(const RGSTile*)(in_data);
+		return true;
+	};
+	const RGSTile16 tile_value = *(const RGSTile16*)(in_data);
+	if (!(in_priorities & (RGS_TILE16_PRIORITY(tile_value) ? RGS_TILE16_HIGH : RGS_TILE16_LOW))) return false;
+	out_tile->pattern = RGS_TILE16_PATTERN(tile_value);
+	out_tile->palette = RGS_TILE16_PALETTE(tile_value);
+	out_tile->hflip = RGS_TILE16_HFLIP(tile_value);
+	out_tile->vflip = RGS_TILE16_VFLIP(tile_value);
+	return true;
+};
+
+static RGS_INLINE void RGSDrawTileSpans(int in_x, int in_y, const void* in_tiles, bool in_packed, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent, uint32_t in_priorities, int in_top, int in_bottom, RGSTileSpan in_span, int in_width, int in_height) {
+	if (in_hwrap) in_x = in_x >= 0 ? (in_x % g_cwidth) : (g_cwidth + (in_x % g_cwidth));
+	if (in_vwrap) in_y = in_y >= 0 ? (in_y % g_cheight) : (g_cheight + (in_y % g_cheight));
+	int column_x[2], column_sample[2], column_count[2];
+	const int column_total = RGSClipSegments(in_x, g_cwidth, g_swidth, g_cwidth, in_hwrap, column_x, column_sample, column_count);
+	if (!column_total) return;
+	int row_y[2], row_sample[2], row_count[2];
+	int row_total = RGSClipSegments(in_y, g_cheight, in_bottom, g_cheight, in_vwrap, row_y, row_sample, row_count);
+	if (in_top) row_total = RGSClipBand(in_top, row_total, row_y, row_sample, row_count);
+	if (g_dback) RGSMarkDirtySegments(column_x, column_count, column_total, row_y, row_count, row_total);
+	const size_t tile_size = in_packed ? sizeof(RGSTile16) : sizeof(RGSTile);
+	const size_t tile_stride = (size_t)((g_cwidth + (in_width - 1)) / in_width) * tile_size;
+	for (int row_index = 0; row_index < row_total; row_index++) {
+		int pixel_y = row_y[row_index];
+		const int pixel_y_end = pixel_y + row_count[row_index];
+		int sample_y = row_sample[row_index] & (in_height - 1);
+		const uint8_t* tile_row = (const uint8_t*)(in_tiles) + ((size_t)(row_sample[row_index] / in_height) * tile_stride);
+		do {
+			for (int column_index = 0; column_index < column_total; column_index++) {
+				int pixel_x = column_x[column_index];
+				int sample_x = column_sample[column_index] & (in_width - 1);
+				const uint8_t* tile_data = tile_row + ((size_t)(column_sample[column_index] / in_width) * tile_size);
+				int pixel_count = column_count[column_index];
+				do {
+					const int span_count = (in_width - sample_x) < pixel_count ? (in_width - sample_x) : pixel_count;
+					RGSTile tile_cell;
+					if (RGSFetchTile(tile_data, in_packed, in_priorities, &tile_cell)) in_span(pixel_x, pixel_y, sample_x, sample_y, span_count, tile_cell, in_palettes, in_transparent, in_width, in_height);
+					tile_data += tile_size;
+					pixel_x += span_count;
+					pixel_count -= span_count;
+					sample_x = 0;
+				}
+				while (pixel_count > 0);
+			};
+			if (++sample_y == in_height) {
+				sample_y = 0;
+				tile_row += tile_stride;
+			};
+		}
+		while (++pixel_y < pixel_y_end);
+	};
+};
+
+static RGS_INLINE int RGSBitmapPitch(const RGSBitmap* in_bitmap) { return in_bitmap->pitch ? (int)(in_bitmap->pitch) : (int)(((in_bitmap->width * in_bitmap->bits_per_pixel) + 7U) >> 3); };
+
+static RGS_INLINE void RGSCopyBitmapSamples(uint8_t* out_data, const uint8_t* in_data, int in_count, bool in_hflip, RGSPalette in_palette, bool in_keyed, uint8_t in_key) {
+	if (g_mdata) {
+#if RGS_GRAPHICS_SIMD
+		RGSBlendSamples8SSE2(out_data, in_data, in_count, in_hflip, in_palette, in_keyed, in_key);
+#else
+		RGSBlendSamples8(out_data, in_data, in_count, in_hflip, in_palette, in_keyed, in_key);
+#endif
+		return;
+	};
+	if (in_keyed && in_key) {
+		const int sample_step = in_hflip ? -1 : 1;
+		for (int sample_index = 0; sample_index < in_count; sample_index++) {
+			const uint8_t sample_value = in_data[sample_index * sample_step];
+			if (sample_value != in_key) out_data[sample_index] = in_palette ? in_palette[sample_value] : sample_value;
+		};
+		return;
+	};
+#if RGS_GRAPHICS_SIMD
+	RGSCopySamples8SSE2(out_data, in_data, in_count, in_hflip, in_palette, in_keyed);
+#else
+	RGSCopySamples8(out_data, in_data, in_count, in_hflip, in_palette, in_keyed);
+#endif
+};
+
+static void RGSDrawBitmapSpan(int in_pixel_x, int in_pixel_y, int in_sample_x, int in_sample_y, int in_count, const RGSBitmap* in_bitmap, RGSPalette in_palette, bool in_hflip, bool in_vflip) {
+	const int bitmap_bits = (int)(in_bitmap->bits_per_pixel);
+	const int bitmap_width = (int)(in_bitmap->width);
+	const int line_size = RGSBitmapPitch(in_bitmap);
+	const uint8_t sample_limit = (uint8_t)((1U << bitmap_bits) - 1U);
+	const bool bitmap_keyed = in_bitmap->transparent && in_bitmap->colour_key <= sample_limit;
+	const uint8_t* const bitmap_line = in_bitmap->pixels + ((size_t)(in_vflip ? ((int)(in_bitmap->height) - 1) - in_sample_y : in_sample_y) * (size_t)(line_size));
+	uint8_t* const pixel_line = g_pixels + (in_pixel_y * g_length);
+	if (bitmap_bits == 8 && g_bits == 8) {
+		RGSCopyBitmapSamples(pixel_line + in_pixel_x, bitmap_line + (in_hflip ? (bitmap_width - 1) - in_sample_x : in_sample_x), in_count, in_hflip, in_palette, bitmap_keyed, in_bitmap->colour_key);
+		return;
+	};
+	const int bitmap_lanes = 64 / bitmap_bits;
+	if (g_bits == 8) {
+		const uint8_t(*const widen_data)[8] = g_swiden[RGSConversionIndex(bitmap_bits, 8)];
+		const int widen_size = 8 / bitmap_bits;
+		uint8_t widen_buffer[64];
+		for (int sample_x = in_sample_x, pixel_x = in_pixel_x, sample_count = in_count; sample_count > 0;) {
+			const int lane_count = sample_count < bitmap_lanes ? sample_count : bitmap_lanes;
+			uint64_t sample_data;
+			if (in_hflip) sample_data = RGSReverseSamples(RGSLoadSamples(bitmap_line, line_size, (bitmap_width - sample_x - lane_count) * bitmap_bits), bitmap_bits) << ((bitmap_lanes - lane_count) * bitmap_bits);
+			else sample_data = RGSLoadSamples(bitmap_line, line_size, sample_x * bitmap_bits);
+			for (int byte_index = 0; byte_index * widen_size < lane_count; byte_index++) memcpy(widen_buffer + (byte_index * widen_size), widen_data[(uint8_t)(sample_data >> (56 - (byte_index << 3)))], (size_t)(widen_size));
+			RGSCopyBitmapSamples(pixel_line + pixel_x, widen_buffer, lane_count, false, in_palette, bitmap_keyed, in_bitmap->colour_key);
+			sample_x += lane_count;
+			pixel_x += lane_count;
+			sample_count -= lane_count;
+		};
+		return;
+	};
+	const int lane_total = bitmap_bits > g_bits ? bitmap_lanes : 64 / g_bits;
+	const uint64_t key_data = bitmap_keyed ? (uint64_t)(in_bitmap->colour_key) * (~0ULL / (uint64_t)(sample_limit)) : 0U;
+	for (int sample_x = in_sample_x, pixel_x = in_pixel_x, sample_count = in_count; sample_count > 0;) {
+		const int lane_count = sample_count < lane_total ? sample_count : lane_total;
+		uint64_t sample_data;
+		if (in_hflip) sample_data = RGSReverseSamples(RGSLoadSamples(bitmap_line, line_size, (bitmap_width - sample_x - lane_count) * bitmap_bits), bitmap_bits) << ((bitmap_lanes - lane_count) * bitmap_bits);
+		else sample_data = RGSLoadSamples(bitmap_line, line_size, sample_x * bitmap_bits);
+		uint64_t pixel_data;
+		uint64_t pixel_mask;
+		if (bitmap_bits == g_bits) {
+			pixel_mask = ~0ULL << (64 - (lane_count * g_bits));
+			if (bitmap_keyed) pixel_mask &= RGSOpaqueSamples(sample_data ^ key_data, g_bits);
+			pixel_data = in_palette ? RGSRemapSamples(sample_data, in_palette, g_bits) : sample_data;
+		}
+		else {
+			pixel_data = 0U;
+			pixel_mask = 0U;
+			for (int lane_index = 0; lane_index < lane_count; lane_index++) {
+				const uint8_t sample_value = (uint8_t)(sample_data >> (64 - ((lane_index + 1) * bitmap_bits))) & sample_limit;
+				if (bitmap_keyed && sample_value == in_bitmap->colour_key) continue;
+				const int pixel_shift = 64 - ((lane_index + 1) * g_bits);
+				pixel_data |= (uint64_t)((in_palette ? in_palette[sample_value] : sample_value) & (g_colours - 1)) << pixel_shift;
+				pixel_mask |= (uint64_t)(g_colours - 1) << pixel_shift;
+			};
+		};
+		if (g_mdata) pixel_data = RGSBlendSamples(pixel_data, RGSLoadSamples(pixel_line, g_length, pixel_x * g_bits), g_bits, lane_count);
+		RGSMergeSamples(pixel_line + ((pixel_x * g_bits) >> 3), (pixel_x * g_bits) & 7, lane_count * g_bits, pixel_data, pixel_mask);
+		sample_x += lane_count;
+		pixel_x += lane_count;
+		sample_count -= lane_count;
+	};
+};
+
+static void RGSDrawBitmapSpans(int in_x, int in_y, const RGSBitmap* in_bitmap, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap, int in_top, int in_bottom) {
+	const int bitmap_width = (int)(in_bitmap->width);
+	const int bitmap_height = (int)(in_bitmap->height);
+	if (in_hwrap && bitmap_width > g_cwidth) in_hwrap = false;
+	if (in_vwrap && bitmap_height > g_cheight) in_vwrap = false;
+	if (in_hwrap) in_x = in_x >= 0 ? (in_x % g_cwidth) : (g_cwidth + (in_x % g_cwidth));
+	if (in_vwrap) in_y = in_y >= 0 ? (in_y % g_cheight) : (g_cheight + (in_y % g_cheight));
+	int column_x[2], column_sample[2], column_count[2];
+	const int column_total = RGSClipSegments(in_x, bitmap_width, g_swidth, g_cwidth, in_hwrap, column_x, column_sample, column_count);
+	if (!column_total) return;
+	int row_y[2], row_sample[2], row_count[2];
+	int row_total = RGSClipSegments(in_y, bitmap_height, in_bottom, g_cheight, in_vwrap, row_y, row_sample, row_count);
+	if (in_top) row_total = RGSClipBand(in_top, row_total, row_y, row_sample, row_count);
+	if (!row_total) return;
+	if (g_dback) RGSMarkDirtySegments(column_x, column_count, column_total, row_y, row_count, row_total);
+	for (int row_index = 0; row_index < row_total; row_index++) {
+		for (int row_offset = 0; row_offset < row_count[row_index]; row_offset++) {
+			for (int column_index = 0; column_index < column_total; column_index++) RGSDrawBitmapSpan(column_x[column_index], row_y[row_index] + row_offset, column_sample[column_index], row_sample[row_index] + row_offset, column_count[column_index], in_bitmap, in_palette, in_hflip, in_vflip);
+		};
+	};
+};
+
+#define RGS_GRAPHICS_KERNELS(_SUFFIX, _TARGET, _SPAN, _WIDTH, _HEIGHT) \
+	static _TARGET void RGSDrawSprite##_SUFFIX(int in_x, int in_y, RGSPattern in_pattern, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap, int in_top, int in_bottom) { \
+		RGSDrawSpriteSpans(in_x, in_y, in_pattern, in_palette, in_hflip, in_vflip, in_hwrap, in_vwrap, in_top, in_bottom, &_SPAN, _WIDTH, _HEIGHT); \
+	}; \
+	static _TARGET void RGSDrawSprites##_SUFFIX(const RGSSpriteDesc* in_sprites, size_t in_count, bool in_sort, int in_top, int in_bottom) { \
+		RGSDrawSpriteBatch(in_sprites, in_count, in_sort, in_top, in_bottom, &_SPAN, _WIDTH, _HEIGHT); \
+	}; \
+	static _TARGET void RGSDrawTiles##_SUFFIX(int in_x, int in_y, const RGSTile* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent, int in_top, int in_bottom) { \
+		RGSDrawTileSpans(in_x, in_y, (const void*)(in_tiles), false, in_palettes, in_hwrap, in_vwrap, in_transparent, RGS_TILE16_ALL, in_top, in_bottom, &_SPAN, _WIDTH, _HEIGHT); \
+	}; \
+	static _TARGET void RGSDrawTileMap16##_SUFFIX(int in_x, int in_y, const RGSTile16* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent, uint32_t in_priorities, int in_top, int in_bottom) { \
+		RGSDrawTileSpans(in_x, in_y, (const void*)(in_tiles), true, in_palettes, in_hwrap, in_vwrap, in_transparent, in_priorities, in_top, in_bottom, &_SPAN, _WIDTH, _HEIGHT); \
+	};
+
+#define RGS_GRAPHICS_SIZED_KERNELS(_SUFFIX, _TARGET, _SPAN) \
+	RGS_GRAPHICS_KERNELS(_SUFFIX##_8x8, _TARGET, _SPAN, 8, 8) \
+	RGS_GRAPHICS_KERNELS(_SUFFIX##_8x16, _TARGET, _SPAN, 8, 16) \
+	RGS_GRAPHICS_KERNELS(_SUFFIX##_8x32, _TARGET, _SPAN, 8, 32) \
+	RGS_GRAPHICS_KERNELS(_SUFFIX##_16x8, _TARGET, _SPAN, 16, 8) \
+	RGS_GRAPHICS_KERNELS(_SUFFIX##_16x16, _TARGET, _SPAN, 16, 16) \
+	RGS_GRAPHICS_KERNELS(_SUFFIX##_16x32, _TARGET, _SPAN, 16, 32) \
+	RGS_GRAPHICS_KERNELS(_SUFFIX##_32x8, _TARGET, _SPAN, 32, 8) \
+	RGS_GRAPHICS_KERNELS(_SUFFIX##_32x16, _TARGET, _SPAN, 32, 16) \
+	RGS_GRAPHICS_KERNELS(_SUFFIX##_32x32, _TARGET, _SPAN, 32, 32)
+
+#define RGS_GRAPHICS_KERNEL_SET(_SUFFIX) { &RGSDrawSprite##_SUFFIX, &RGSDrawSprites##_SUFFIX, &RGSDrawTiles##_SUFFIX, &RGSDrawTileMap16##_SUFFIX }
+
+#define RGS_GRAPHICS_SIZED_KERNEL_SETS(_SUFFIX) { \
+	RGS_GRAPHICS_KERNEL_SET(_SUFFIX##_8x8), RGS_GRAPHICS_KERNEL_SET(_SUFFIX##_8x16), RGS_GRAPHICS_KERNEL_SET(_SUFFIX##_8x32), \
+	RGS_GRAPHICS_KERNEL_SET(_SUFFIX##_16x8), RGS_GRAPHICS_KERNEL_SET(_SUFFIX##_16x16), RGS_GRAPHICS_KERNEL_SET(_SUFFIX##_16x32), \
+	RGS_GRAPHICS_KERNEL_SET(_SUFFIX##_32x8), RGS_GRAPHICS_KERNEL_SET(_SUFFIX##_32x16), RGS_GRAPHICS_KERNEL_SET(_SUFFIX##_32x32) \
+}
+
+RGS_GRAPHICS_KERNELS(1, , RGSDrawTileSpan1, g_pwidth, g_pheight)
+RGS_GRAPHICS_KERNELS(2, , RGSDrawTileSpan2, g_pwidth, g_pheight)
+RGS_GRAPHICS_KERNELS(4, , RGSDrawTileSpan4, g_pwidth, g_pheight)
+RGS_GRAPHICS_KERNELS(8, , RGSDrawTileSpan8, g_pwidth, g_pheight)
+#if RGS_GRAPHICS_SIMD
+RGS_GRAPHICS_KERNELS(8SSE2, , RGSDrawTileSpan8SSE2, g_pwidth, g_pheight)
+RGS_GRAPHICS_KERNELS(8AVX2, RGS_TARGET("avx2"), RGSDrawTileSpan8AVX2, g_pwidth, g_pheight)
+#endif
+
+#if RGS_GRAPHICS_SPECIALISED
+RGS_GRAPHICS_SIZED_KERNELS(1, , RGSDrawTileSpan1)
+RGS_GRAPHICS_SIZED_KERNELS(2, , RGSDrawTileSpan2)
+RGS_GRAPHICS_SIZED_KERNELS(4, , RGSDrawTileSpan4)
+#if RGS_GRAPHICS_SIMD
+RGS_GRAPHICS_SIZED_KERNELS(8SSE2, , RGSDrawTileSpan8SSE2)
+RGS_GRAPHICS_SIZED_KERNELS(8AVX2, RGS_TARGET("avx2"), RGSDrawTileSpan8AVX2)
+#else
+RGS_GRAPHICS_SIZED_KERNELS(8, , RGSDrawTileSpan8)
+#endif
+
+static const RGSDrawKernels g_kernels1[9] = RGS_GRAPHICS_SIZED_KERNEL_SETS(1);
+static const RGSDrawKernels g_kernels2[9] = RGS_GRAPHICS_SIZED_KERNEL_SETS(2);
+static const RGSDrawKernels g_kernels4[9] = RGS_GRAPHICS_SIZED_KERNEL_SETS(4);
+#if RGS_GRAPHICS_SIMD
+static const RGSDrawKernels g_kernels8SSE2[9] = RGS_GRAPHICS_SIZED_KERNEL_SETS(8SSE2);
+static const RGSDrawKernels g_kernels8AVX2[9] = RGS_GRAPHICS_SIZED_KERNEL_SETS(8AVX2);
+#else
+static const RGSDrawKernels g_kernels8[9] = RGS_GRAPHICS_SIZED_KERNEL_SETS(8);
+#endif
+
+static const RGSDrawKernels* RGSSpecialisedKernels() {
+	const int kernel_index = ((g_pwidth >> 4) * 3) + (g_pheight >> 4);
+	switch (g_bits) {
+	case 1: return g_kernels1 + kernel_index;
+	case 2: return g_kernels2 + kernel_index;
+	case 4: return g_kernels4 + kernel_index;
+#if RGS_GRAPHICS_SIMD
+	default: return (g_draw_tiles == &RGSDrawTiles8AVX2 ? g_kernels8AVX2 : g_kernels8SSE2) + kernel_index;
+#else
+	default: return g_kernels8 + kernel_index;
+#endif
+	};
+};
+#endif
+
+
+static bool RGSReserveSpriteKeys(size_t in_count) {
+	if (in_count > 0xFFFFFFFFU) return false;
+	if (!g_scells) {
+		g_scells = (uint32_t*)(calloc((size_t)((g_swidth / g_pwidth) * (g_sheight / g_pheight)), sizeof(*g_scells)));
+		if (!g_scells) {
+			RGSReportWarning("Graphics", "Failed to allocate sprite cells, sprites won't be sorted");
+			return false;
+		};
+		g_sstamp = 1U;
+	};
+	if (in_count > g_scapacity) {
+		uint64_t* const sprite_keys = (uint64_t*)(realloc((void*)(g_skeys), in_count * sizeof(*g_skeys)));
+		if (!sprite_keys) {
+			RGSReportWarning("Graphics", "Failed to allocate sprite keys, sprites won't be sorted");
+			return false;
+		};
+		g_skeys = sprite_keys;
+		g_scapacity = in_count;
+	};
+	return true;
+};
+
+static bool RGSReservePaletteBank() {
+	if (g_lbank) return true;
+	const size_t palette_stride = g_colours < 16 ? 16U : (size_t)(g_colours);
+	g_lstore = (uint8_t*)(malloc((palette_stride << 8U) + 63U));
+	if (!g_lstore) {
+		RGSReportWarning("Graphics", "Failed to allocate palette bank");
+		return false;
+	};
+	uint8_t* const bank_data = (uint8_t*)(((uintptr_t)(g_lstore) + 63U) & ~(uintptr_t)(63U));
+	for (size_t palette_index = 0U; palette_index < 256U; palette_index++) {
+		uint8_t* const palette_data = bank_data + (palette_index * palette_stride);
+		for (size_t colour_index = 0U; colour_index < palette_stride; colour_index++) palette_data[colour_index] = (uint8_t)(colour_index & (size_t)(g_colours - 1));
+		g_llist[palette_index] = palette_data;
+	};
+	g_lstride = palette_stride;
+	g_lbank = bank_data;
+	return true;
+};
+
+static RGS_INLINE const RGSColour* RGSColourData() {
+#if RGS_OS == RGS_OS_WINDOWS
+	return (const RGSColour*)(g_bitmap->bmiColors);
+#elif RGS_OS == RGS_OS_LINUX
+	return g_palette;
+#endif
+};
+
+static bool RGSQueueRelease(void (*in_release)(void*), void* inout_data) {
+	if (!g_ccount) {
+		in_release(inout_data);
+		return true;
+	};
+	if (g_arcount == g_arcapacity) {
+		const size_t release_capacity = g_arcapacity ? g_arcapacity << 1U : 8U;
+		RGSDeferredRelease* const release_list = (RGSDeferredRelease*)(realloc((void*)(g_areleases), release_capacity * sizeof(*g_areleases)));
+		if (!release_list) return false;
+		g_areleases = release_list;
+		g_arcapacity = release_capacity;
+	};
+	g_areleases[g_arcount].release = in_release;
+	g_areleases[g_arcount].data = inout_data;
+	g_arcount++;
+	return true;
+};
+
+static RGS_INLINE int RGSCellDistance(int in_value, int in_low, bool in_furthest) {
+	const int high_value = in_low + 31;
+	const int channel_delta = in_furthest ? (in_value - in_low > high_value - in_value ? in_value - in_low : high_value - in_value) : (in_value < in_low ? in_low - in_value : (in_value > high_value ? in_value - high_value : 0));
+	return channel_delta * channel_delta;
+};
+
+static void RGSBuildColourCell(const RGSColour* in_colours, int in_cell) {
+	const int red_low = (in_cell >> 6) << 5;
+	const int green_low = ((in_cell >> 3) & 7) << 5;
+	const int blue_low = (in_cell & 7) << 5;
+	int furthest_bound = 0x7FFFFFFF;
+	for (int colour_index = 0; colour_index < g_colours; colour_index++) {
+		const RGSColour colour_value = in_colours[colour_index];
+		const int furthest_distance = RGSCellDistance((int)(RGS_COLOUR_RED(colour_value)), red_low, true) + RGSCellDistance((int)(RGS_COLOUR_GREEN(colour_value)), green_low, true) + RGSCellDistance((int)(RGS_COLOUR_BLUE(colour_value)), blue_low, true);
+		if (furthest_distance < furthest_bound) furthest_bound = furthest_distance;
+	};
+	int candidate_count = 0;
+	for (int colour_index = 0; colour_index < g_colours; colour_index++) {
+		const RGSColour colour_value = in_colours[colour_index];
+		const int nearest_distance = RGSCellDistance((int)(RGS_COLOUR_RED(colour_value)), red_low, false) + RGSCellDistance((int)(RGS_COLOUR_GREEN(colour_value)), green_low, false) + RGSCellDistance((int)(RGS_COLOUR_BLUE(colour_value)), blue_low, false);
+		if (nearest_distance <= furthest_bound) g_mcandidates[in_cell][candidate_count++] = (uint8_t)(colour_index);
+	};
+	g_mccounts[in_cell] = candidate_count;
+};
+
+static uint8_t RGSNearestColour(const RGSColour* in_colours, int in_red, int in_green, int in_blue) {
+	const int cell_index = ((in_red >> 5) << 6) | ((in_green >> 5) << 3) | (in_blue >> 5);
+	if (g_mccounts[cell_index] < 0) RGSBuildColourCell(in_colours, cell_index);
+	const uint8_t* const cell_candidates = g_mcandidates[cell_index];
+	uint8_t nearest_index = 0U;
+	int nearest_distance = 0x7FFFFFFF;
+	for (int candidate_index = 0; candidate_index < g_mccounts[cell_index]; candidate_index++) {
+		const RGSColour colour_value = in_colours[cell_candidates[candidate_index]];
+		const int red_delta = (int)(RGS_COLOUR_RED(colour_value)) - in_red;
+		const int green_delta = (int)(RGS_COLOUR_GREEN(colour_value)) - in_green;
+		const int blue_delta = (int)(RGS_COLOUR_BLUE(colour_value)) - in_blue;
+		const int colour_distance = (red_delta * red_delta) + (green_delta * green_delta) + (blue_delta * blue_delta);
+		if (colour_distance < nearest_distance) {
+			nearest_index = cell_candidates[candidate_index];
+			nearest_distance = colour_distance;
+			if (!colour_distance) break;
+		};
+	};
+	return nearest_index;
+};
+
+static RGS_INLINE int RGSBlendChannel(int in_source, int in_target, RGSBlendMode in_mode) {
+	switch (in_mode) {
+	case RGS_BLEND_HALF: return (in_source + in_target + 1) >> 1;
+	case RGS_BLEND_ADD: return in_source + in_target < 255 ? in_source + in_target : 255;
+	case RGS_BLEND_SUBTRACT: return in_target > in_source ? in_target - in_source : 0;
+	case RGS_BLEND_MULTIPLY: return ((in_source * in_target) + 127) / 255;
+	default: return in_target >> 1;
+	};
+};
+
+static void RGSBuildBlendTable(uint8_t* out_table, RGSBlendMode in_mode) {
+	const RGSColour* const colour_data = RGSColourData();
+	memset((void*)(g_mccounts), 0xFF, sizeof(g_mccounts));
+	for (int source_index = 0; source_index < g_colours; source_index++) {
+		uint8_t* const table_row = out_table + (source_index << g_depth);
+		if (source_index && in_mode == RGS_BLEND_SHADOW) {
+			memcpy((void*)(table_row), (const void*)(out_table), (size_t)(g_colours));
+			continue;
+		};
+		const RGSColour source_colour = colour_data[source_index];
+		for (int target_index = 0; target_index < g_colours; target_index++) {
+			const RGSColour target_colour = colour_data[target_index];
+			if (in_mode == RGS_BLEND_HALF && target_index < source_index) {
+				table_row[target_index] = out_table[(target_index << g_depth) | source_index];
+				continue;
+			};
+			table_row[target_index] = RGSNearestColour(colour_data,
+				RGSBlendChannel((int)(RGS_COLOUR_RED(source_colour)), (int)(RGS_COLOUR_RED(target_colour)), in_mode),
+				RGSBlendChannel((int)(RGS_COLOUR_GREEN(source_colour)), (int)(RGS_COLOUR_GREEN(target_colour)), in_mode),
+				RGSBlendChannel((int)(RGS_COLOUR_BLUE(source_colour)), (int)(RGS_COLOUR_BLUE(target_colour)), in_mode));
+		};
+	};
+};
+
+static const uint8_t* RGSBlendTable() {
+	if (g_mselected == RGS_BLEND_NONE || g_mbuilt[g_mselected] == g_mversion) return g_mtables[g_mselected];
+	uint8_t* const blend_table = (uint8_t*)(malloc((size_t)(g_colours * g_colours)));
+	if (!blend_table) {
+		RGSReportWarning("Graphics", "Failed to allocate blend table, keeping the previous blend table");
+		return g_mtables[g_mselected];
+	};
+	RGSBuildBlendTable(blend_table, g_mselected);
+	RGSActivateLock(RGS_LOCK_PASS(g_rlock));
+	if (g_mtables[g_mselected] && !RGSQueueRelease(free, (void*)(g_mtables[g_mselected]))) {
+		RGSDeactivateLock(RGS_LOCK_PASS(g_rlock));
+		free((void*)(blend_table));
+		RGSReportWarning("Graphics", "Failed to retire blend table, keeping the previous blend table");
+		return g_mtables[g_mselected];
+	};
+	g_mtables[g_mselected] = blend_table;
+	RGSDeactivateLock(RGS_LOCK_PASS(g_rlock));
+	g_mbuilt[g_mselected] = g_mversion;
+	return blend_table;
+};
+
+static RGSColour* RGSEffectColours() {
+#if RGS_OS == RGS_OS_WINDOWS
+	if (!g_ebitmap) {
+		const size_t bitmap_size = sizeof(*g_bitmap) + (sizeof(*g_bitmap->bmiColors) * ((size_t)(g_colours) - 1U));
+		g_ebitmap = (LPBITMAPINFO)(malloc(bitmap_size));
+		if (!g_ebitmap) {
+			RGSReportWarning("Graphics", "Failed to allocate effect colours, presenting without colour effects");
+			return RGS_NULL;
+		};
+		memcpy((void*)(g_ebitmap), (const void*)(g_bitmap), bitmap_size);
+	};
+	return (RGSColour*)(g_ebitmap->bmiColors);
+#elif RGS_OS == RGS_OS_LINUX
+	if (!g_ecolours) {
+		g_ecolours = (RGSColour*)(malloc((size_t)(g_colours) * sizeof(*g_ecolours)));
+		if (!g_ecolours) RGSReportWarning("Graphics", "Failed to allocate effect colours, presenting without colour effects");
+	};
+	return g_ecolours;
+#endif
+};
+
+static RGS_INLINE RGSTime RGSEffectElapsed(RGSTime in_started, RGSTime in_time) { return in_time > in_started ? in_time - in_started : 0ULL; };
+
+static int RGSFadeLevel(RGSTime in_time) {
+	const RGSTime elapsed_time = RGSEffectElapsed(g_efade.started, in_time);
+	if (elapsed_time >= g_efade.duration) return g_efade.to;
+	return g_efade.from + (int)(((int64_t)(g_efade.to - g_efade.from) * (int64_t)(elapsed_time)) / (int64_t)(g_efade.duration));
+};
+
+static int RGSFlashLevel(RGSTime in_time) {
+	RGSTime elapsed_time = RGSEffectElapsed(g_eflash.started, in_time);
+	if (elapsed_time < g_eflash.attack) return (int)((255ULL * elapsed_time) / g_eflash.attack);
+	elapsed_time -= g_eflash.attack;
+	if (elapsed_time < g_eflash.hold) return 255;
+	elapsed_time -= g_eflash.hold;
+	if (elapsed_time < g_eflash.release) return 255 - (int)((255ULL * elapsed_time) / g_eflash.release);
+	return 0;
+};
+
+static RGS_INLINE RGSColour RGSMixColour(RGSColour in_colour, RGSColour in_target, int in_level) {
+	const int red_value = (((int)(RGS_COLOUR_RED(in_colour)) * (255 - in_level)) + ((int)(RGS_COLOUR_RED(in_target)) * in_level) + 127) / 255;
+	const int green_value = (((int)(RGS_COLOUR_GREEN(in_colour)) * (255 - in_level)) + ((int)(RGS_COLOUR_GREEN(in_target)) * in_level) + 127) / 255;
+	const int blue_value = (((int)(RGS_COLOUR_BLUE(in_colour)) * (255 - in_level)) + ((int)(RGS_COLOUR_BLUE(in_target)) * in_level) + 127) / 255;
+	return RGS_COLOUR_MAKE(red_value, green_value, blue_value);
+};
+
+static void RGSApplyColourEffects(RGSTime in_time) {
+	if (g_efade.from != g_efade.to && RGSEffectElapsed(g_efade.started, in_time) >= g_efade.duration) g_efade.from = g_efade.to;
+	const int fade_level = RGSFadeLevel(in_time);
+	const int flash_level = g_eflash.active ? RGSFlashLevel(in_time) : 0;
+	if (g_eflash.active && !flash_level && RGSEffectElapsed(g_eflash.started, in_time) >= g_eflash.attack) g_eflash.active = false;
+	bool effects_running = fade_level || g_eflash.active;
+	for (uint32_t cycle_index = 0U; cycle_index < RGS_COLOUR_CYCLE_LIMIT; cycle_index++) effects_running |= g_ecycles[cycle_index].count > 1;
+	if (!effects_running) {
+		if (g_eactive) {
+			g_eactive = false;
+			g_repaint = true;
+		};
+		return;
+	};
+	RGSColour* const effect_data = RGSEffectColours();
+	if (!effect_data) return;
+	RGSColour colour_data[256];
+	memcpy((void*)(colour_data), (const void*)(RGSColourData()), (size_t)(g_colours) * sizeof(*colour_data));
+	for (uint32_t cycle_index = 0U; cycle_index < RGS_COLOUR_CYCLE_LIMIT; cycle_index++) {
+		const RGSColourCycle* const colour_cycle = g_ecycles + cycle_index;
+		if (colour_cycle->count < 2) continue;
+		RGSColour range_data[256];
+		memcpy((void*)(range_data), (const void*)(colour_data + colour_cycle->first), (size_t)(colour_cycle->count) * sizeof(*range_data));
+		int cycle_step = (int)((RGSEffectElapsed(colour_cycle->started, in_time) / colour_cycle->period) % (RGSTime)(colour_cycle->count));
+		if (colour_cycle->reverse && cycle_step) cycle_step = colour_cycle->count - cycle_step;
+		for (int range_index = 0; range_index < colour_cycle->count; range_index++) colour_data[colour_cycle->first + ((range_index + cycle_step) % colour_cycle->count)] = range_data[range_index];
+	};
+	if (fade_level) {
+		for (int colour_index = 0; colour_index < g_colours; colour_index++) colour_data[colour_index] = RGSMixColour(colour_data[colour_index], g_efade.colour, fade_level);
+	};
+	if (flash_level) {
+		for (int colour_index = 0; colour_index < g_colours; colour_index++) colour_data[colour_index] = RGSMixColour(colour_data[colour_index], g_eflash.colour, flash_level);
+	};
+	if (!g_eactive || memcmp((const void*)(effect_data), (const void*)(colour_data), (size_t)(g_colours) * sizeof(*colour_data))) {
+		memcpy((void*)(effect_data), (const void*)(colour_data), (size_t)(g_colours) * sizeof(*colour_data));
+		g_eactive = true;
+		g_repaint = true;
+	};
+};
+
+static RGS_INLINE int RGSBandTop(int in_band) { return ((in_band * (g_sheight / g_pheight)) / g_bcount) * g_pheight; };
+
+static void RGSDrawBand(int in_band) {
+	const int band_top = RGSBandTop(in_band);
+	const int band_bottom = RGSBandTop(in_band + 1);
+	for (const RGSDrawCommand* draw_command = g_clist; draw_command < g_clist + g_ccount; draw_command++) {
+		g_pdata = draw_command->patterns;
+		g_mdata = draw_command->blend;
+		switch (draw_command->type) {
+		case RGS_DRAW_COMMAND_TYPE_PIXEL:
+			if (draw_command->pixel.y < band_top || draw_command->pixel.y >= band_bottom) break;
+			if (g_dback) RGSMarkDirty(draw_command->pixel.x, draw_command->pixel.y, 1, 1);
+			g_set_pixel(draw_command->pixel.x, draw_command->pixel.y, draw_command->pixel.index);
+			break;
+		case RGS_DRAW_COMMAND_TYPE_SPRITES:
+			g_draw_sprites(draw_command->sprites.list, draw_command->sprites.count, g_bcount == 1 && draw_command->sprites.sort && RGSReserveSpriteKeys(draw_command->sprites.count), band_top, band_bottom);
+			break;
+		case RGS_DRAW_COMMAND_TYPE_TILES:
+			g_draw_tiles(draw_command->tiles.x, draw_command->tiles.y, draw_command->tiles.list, draw_command->tiles.palettes, draw_command->tiles.hwrap, draw_command->tiles.vwrap, draw_command->tiles.transparent, band_top, band_bottom);
+			break;
+		case RGS_DRAW_COMMAND_TYPE_TILEMAP16:
+			g_draw_tilemap16(draw_command->tilemap16.x, draw_command->tilemap16.y, draw_command->tilemap16.list, draw_command->tilemap16.palettes, draw_command->tilemap16.hwrap, draw_command->tilemap16.vwrap, draw_command->tilemap16.transparent, draw_command->tilemap16.priorities, band_top, band_bottom);
+			break;
+		case RGS_DRAW_COMMAND_TYPE_BITMAP:
+			RGSDrawBitmapSpans(draw_command->bitmap.x, draw_command->bitmap.y, &draw_command->bitmap.desc, draw_command->bitmap.palette, draw_command->bitmap.hflip, draw_command->bitmap.vflip, draw_command->bitmap.hwrap, draw_command->bitmap.vwrap, band_top, band_bottom);
+			break;
+		case RGS_DRAW_COMMAND_TYPE_RECT:
+			RGSFillRectangle(draw_command->rect.x, draw_command->rect.y, draw_command->rect.width, draw_command->rect.height, draw_command->rect.index, band_top, band_bottom);
+			break;
+		case RGS_DRAW_COMMAND_TYPE_LINE:
+			RGSDrawLineSpans(draw_command->line.start_x, draw_command->line.start_y, draw_command->line.end_x, draw_command->line.end_y, draw_command->line.index, band_top, band_bottom);
+			break;
+		case RGS_DRAW_COMMAND_TYPE_CIRCLE:
+			RGSFillCircleSpans(draw_command->circle.x, draw_command->circle.y, draw_command->circle.radius, draw_command->circle.index, band_top, band_bottom);
+			break;
+		};
+	};
+};
+
+static void RGSDrawWorkerJob(void* inout_parameters) {
+	const int band_index = (int)((intptr_t)(inout_parameters));
+	long band_generation = RGSReadCounter(RGS_COUNTER_PASS(g_wgeneration));
+	RGSDeactivateLock(RGS_LOCK_PASS(g_wlock));
+	while (true) {
+		long current_generation;
+		while ((current_generation = RGSReadCounter(RGS_COUNTER_PASS(g_wgeneration))) == band_generation) RGSWaitForCounter(RGS_COUNTER_PASS(g_wgeneration), band_generation);
+		band_generation = current_generation;
+		if (!g_wrunning) return;
+		RGSDrawBand(band_index);
+		if (!RGSAddToCounter(RGS_COUNTER_PASS(g_wpending), -1L)) RGSWakeCounterWaiters(RGS_COUNTER_PASS(g_wpending));
+	};
+};
+
+static void* RGSArenaAllocate(size_t in_size) {
+	in_size = (in_size + 7U) & ~(size_t)(7U);
+	while (g_acurrent && g_acurrent->used + in_size > g_acurrent->capacity) {
+		g_acurrent = g_acurrent->next;
+		if (g_acurrent) g_acurrent->used = 0U;
+	};
+	if (!g_acurrent) {
+		const size_t block_capacity = in_size > RGS_GRAPHICS_ARENA_SIZE ? in_size : RGS_GRAPHICS_ARENA_SIZE;
+		RGSArenaBlock* const arena_block = (RGSArenaBlock*)(malloc(sizeof(*arena_block) + block_capacity));
+		if (!arena_block) {
+			RGSReportWarning("Graphics", "Failed to allocate draw arena, drawing on the rendering thread");
+			return RGS_NULL;
+		};
+		arena_block->next = RGS_NULL;
+		arena_block->capacity = block_capacity;
+		arena_block->used = 0U;
+		if (g_alast) g_alast->next = arena_block;
+		else g_afirst = arena_block;
+		g_alast = arena_block;
+		g_acurrent = arena_block;
+	};
+	void* const arena_data = (void*)(g_acurrent->data + g_acurrent->used);
+	g_acurrent->used += in_size;
+	g_ctally.bytes += (uint32_t)(in_size);
+	return arena_data;
+};
+
+static void RGSResetArena() {
+	g_acurrent = g_afirst;
+	if (g_acurrent) g_acurrent->used = 0U;
+	memset((void*)(g_acopies), 0, sizeof(g_acopies));
+	for (size_t release_index = 0U; release_index < g_arcount; release_index++) g_areleases[release_index].release(g_areleases[release_index].data);
+	g_arcount = 0U;
+};
+
+static bool RGSCopyPalette(RGSPalette in_palette, RGSPalette* out_copy) {
+	if (!in_palette || RGSBankedPalette(in_palette)) {
+		*out_copy = in_palette;
+		return true;
+	};
+	RGSPaletteCopy* const palette_copy = g_acopies + ((((uintptr_t)(in_palette) >> 4U) ^ ((uintptr_t)(in_palette) >> 10U)) % RGS_GRAPHICS_PALETTE_COPIES);
+	if (palette_copy->source != in_palette || memcmp((const void*)(palette_copy->copy), (const void*)(in_palette), (size_t)(g_colours))) {
+		uint8_t* const palette_data = (uint8_t*)(RGSArenaAllocate((size_t)(g_colours)));
+		if (!palette_data) return false;
+		memcpy((void*)(palette_data), (const void*)(in_palette), (size_t)(g_colours));
+		palette_copy->source = in_palette;
+		palette_copy->copy = palette_data;
+	};
+	*out_copy = palette_copy->copy;
+	return true;
+};
+
+static bool RGSCopySprites(const RGSSpriteDesc* in_sprites, size_t in_count, RGSSpriteDesc** out_copy) {
+	RGSSpriteDesc* const sprite_list = (RGSSpriteDesc*)(RGSArenaAllocate(in_count * sizeof(*sprite_list)));
+	if (!sprite_list) return false;
+	for (size_t sprite_index = 0U; sprite_index < in_count; sprite_index++) {
+		sprite_list[sprite_index] = in_sprites[sprite_index];
+		if (!RGSCopyPalette(in_sprites[sprite_index].palette, &sprite_list[sprite_index].palette)) return false;
+	};
+	*out_copy = sprite_list;
+	return true;
+};
+
+static bool RGSCopyPalettes(const RGSPalette* in_palettes, uint8_t in_last, const RGSPalette** out_palettes) {
+	*out_palettes = in_palettes;
+	if (!in_palettes || in_palettes == g_llist) return true;
+	RGSPalette* const palette_list = (RGSPalette*)(RGSArenaAllocate(((size_t)(in_last) + 1U) * sizeof(*palette_list)));
+	if (!palette_list) return false;
+	for (int palette_index = 0; palette_index <= in_last; palette_index++) {
+		if (!RGSCopyPalette(in_palettes[palette_index], palette_list + palette_index)) return false;
+	};
+	*out_palettes = palette_list;
+	return true;
+};
+
+static bool RGSCopyTiles(const RGSTile* in_tiles, const RGSPalette* in_palettes, const RGSTile** out_tiles, const RGSPalette** out_palettes) {
+	const size_t tile_count = (size_t)((g_cwidth / g_pwidth) * (g_cheight / g_pheight));
+	RGSTile* const tile_list = (RGSTile*)(RGSArenaAllocate(tile_count * sizeof(*tile_list)));
+	if (!tile_list) return false;
+	uint8_t palette_last = 0U;
+	for (size_t tile_index = 0U; tile_index < tile_count; tile_index++) {
+		tile_list[tile_index] = in_tiles[tile_index];
+		if (in_tiles[tile_index].palette > palette_last) palette_last = in_tiles[tile_index].palette;
+	};
+	*out_tiles = tile_list;
+	return RGSCopyPalettes(in_palettes, palette_last, out_palettes);
+};
+
+static bool RGSCopyTileMap16(const RGSTile16* in_tiles, const RGSPalette* in_palettes, const RGSTile16** out_tiles, const RGSPalette** out_palettes) {
+	const size_t tile_count = (size_t)((g_cwidth / g_pwidth) * (g_cheight / g_pheight));
+	RGSTile16* const tile_list = (RGSTile16*)(RGSArenaAllocate(tile_count * sizeof(*tile_list)));
+	if (!tile_list) return false;
+	uint8_t palette_last = 0U;
+	for (size_t tile_index = 0U; tile_index < tile_count; tile_index++) {
+		tile_list[tile_index] = in_tiles[tile_index];
+		if (RGS_TILE16_PALETTE(in_tiles[tile_index]) > palette_last) palette_last = RGS_TILE16_PALETTE(in_tiles[tile_index]);
+	};
+	*out_tiles = tile_list;
+	return RGSCopyPalettes(in_palettes, palette_last, out_palettes);
+};
+
+static bool RGSRecordCommand(const RGSDrawCommand* in_command) {
+	if (g_ccount >= g_ccapacity) {
+		const size_t command_capacity = g_ccount + 64U;
+		RGSDrawCommand* const command_list = (RGSDrawCommand*)(realloc((void*)(g_clist), command_capacity * sizeof(*command_list)));
+		if (!command_list) {
+			RGSReportWarning("Graphics", "Failed to allocate draw commands, drawing on the rendering thread");
+			return false;
+		};
+		g_clist = command_list;
+		g_ccapacity = command_capacity;
+	};
+	g_clist[g_ccount++] = *in_command;
+	return true;
+};
+
+static void RGSClearPixels() {
+	if (g_dback) RGSClearDirty();
+	else memset((void*)(g_pixels), 0, (size_t)(g_length * g_sheight) * sizeof(*g_pixels));
+};
+
+static void RGSSwapPixels() {
+	uint8_t* const drawn_pixels = g_pixels;
+	g_pixels = g_front;
+	g_front = drawn_pixels;
+	uint8_t* const drawn_cells = g_dback;
+	g_dback = g_dfront;
+	g_dfront = drawn_cells;
+};
+
+static void RGSFlushCommands() {
+	if (!g_cleared) {
+		if (!g_ccovered) RGSClearPixels();
+		g_cleared = true;
+	};
+	g_ccovered = false;
+	if (!g_ccount) {
+		RGSResetArena();
+		return;
+	};
+	RGSAddToCounter(RGS_COUNTER_PASS(g_wpending), (long)(g_bcount - 1));
+	RGSAddToCounter(RGS_COUNTER_PASS(g_wgeneration), 1L);
+	RGSWakeCounterWaiters(RGS_COUNTER_PASS(g_wgeneration));
+	RGSDrawBand(0);
+	for (long band_pending; (band_pending = RGSReadCounter(RGS_COUNTER_PASS(g_wpending))) != 0L;) RGSWaitForCounter(RGS_COUNTER_PASS(g_wpending), band_pending);
+	g_ctally.commands += (uint32_t)(g_ccount);
+	g_ccount = 0U;
+	RGSResetArena();
+};
+
+static void RGSSkipCommands() {
+	g_ctally.skipped += (uint32_t)(g_ccount);
+	g_ccount = 0U;
+	g_ccovered = true;
+	RGSResetArena();
+};
+
+static bool RGSRecordPixel(int in_x, int in_y, uint8_t in_index) {
+	if (!g_deferred && g_bcount < 2) return false;
+	RGSDrawCommand draw_command;
+	draw_command.type = RGS_DRAW_COMMAND_TYPE_PIXEL;
+	draw_command.patterns = RGS_NULL;
+	draw_command.blend = RGS_NULL;
+	draw_command.pixel.x = in_x;
+	draw_command.pixel.y = in_y;
+	draw_command.pixel.index = in_index;
+	if (!RGSRecordCommand(&draw_command)) {
+		RGSFlushCommands();
+		return false;
+	};
+	g_ctally.pixels++;
+	return true;
+};
+
+static bool RGSRecordBitmap(int in_x, int in_y, const RGSBitmap* in_bitmap, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap) {
+	if (!g_deferred && g_bcount < 2) return false;
+	RGSDrawCommand draw_command;
+	draw_command.type = RGS_DRAW_COMMAND_TYPE_BITMAP;
+	draw_command.patterns = RGS_NULL;
+	draw_command.blend = RGSBlendTable();
+	draw_command.bitmap.x = in_x;
+	draw_command.bitmap.y = in_y;
+	draw_command.bitmap.desc = *in_bitmap;
+	draw_command.bitmap.hflip = in_hflip;
+	draw_command.bitmap.vflip = in_vflip;
+	draw_command.bitmap.hwrap = in_hwrap;
+	draw_command.bitmap.vwrap = in_vwrap;
+	const size_t palette_size = (size_t)(1U << in_bitmap->bits_per_pixel);
+	bool palette_copied;
+	if (in_palette && palette_size > (size_t)(g_colours)) {
+		uint8_t* const palette_data = (uint8_t*)(RGSArenaAllocate(palette_size));
+		if (palette_data) memcpy((void*)(palette_data), (const void*)(in_palette), palette_size);
+		draw_command.bitmap.palette = palette_data;
+		palette_copied = palette_data != RGS_NULL;
+	}
+	else palette_copied = RGSCopyPalette(in_palette, &draw_command.bitmap.palette);
+	if (!palette_copied || !RGSRecordCommand(&draw_command)) {
+		RGSFlushCommands();
+		return false;
+	};
+	g_ctally.bitmaps++;
+	return true;
+};
+
+static bool RGSRecordShape(const RGSDrawCommand* in_command) {
+	if (!g_deferred && g_bcount < 2) return false;
+	if (!RGSRecordCommand(in_command)) {
+		RGSFlushCommands();
+		return false;
+	};
+	g_ctally.shapes++;
+	return true;
+};
+
+static bool RGSRecordSprites(const RGSSpriteDesc* in_sprites, size_t in_count, bool in_sort) {
+	if (!g_deferred && g_bcount < 2) return false;
+	RGSSpriteDesc* sprite_list;
+	if (!RGSCopySprites(in_sprites, in_count, &sprite_list)) {
+		RGSFlushCommands();
+		return false;
+	};
+	const uint8_t* const blend_data = RGSBlendTable();
+	RGSDrawCommand* const last_command = g_ccount ? g_clist + (g_ccount - 1U) : RGS_NULL;
+	if (last_command && last_command->type == RGS_DRAW_COMMAND_TYPE_SPRITES && last_command->patterns == g_pbanks[g_pselected].live && last_command->blend == blend_data && last_command->sprites.sort == in_sort && last_command->sprites.list + last_command->sprites.count == sprite_list) {
+		last_command->sprites.count += in_count;
+		g_ctally.merged++;
+	}
+	else {
+		RGSDrawCommand draw_command;
+		draw_command.type = RGS_DRAW_COMMAND_TYPE_SPRITES;
+		draw_command.patterns = g_pbanks[g_pselected].live;
+		draw_command.blend = blend_data;
+		draw_command.sprites.list = sprite_list;
+		draw_command.sprites.count = in_count;
+		draw_command.sprites.sort = in_sort;
+		if (!RGSRecordCommand(&draw_command)) {
+			RGSFlushCommands();
+			return false;
+		};
+	};
+	g_ctally.sprites += (uint32_t)(in_count);
+	return true;
+};
+
+static bool RGSRecordTiles(int in_x, int in_y, const RGSTile* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent) {
+	if (!g_deferred && g_bcount < 2) return false;
+	const uint8_t* const blend_data = RGSBlendTable();
+	if (!in_transparent && !blend_data && (in_hwrap || (in_x <= 0 && in_x + g_cwidth >= g_swidth)) && (in_vwrap || (in_y <= 0 && in_y + g_cheight >= g_sheight))) RGSSkipCommands();
+	RGSDrawCommand draw_command;
+	draw_command.type = RGS_DRAW_COMMAND_TYPE_TILES;
+	draw_command.patterns = g_pbanks[g_pselected].live;
+	draw_command.blend = blend_data;
+	draw_command.tiles.x = in_x;
+	draw_command.tiles.y = in_y;
+	draw_command.tiles.hwrap = in_hwrap;
+	draw_command.tiles.vwrap = in_vwrap;
+	draw_command.tiles.transparent = in_transparent;
+	if (!RGSCopyTiles(in_tiles, in_palettes, &draw_command.tiles.list, &draw_command.tiles.palettes) || !RGSRecordCommand(&draw_command)) {
+		RGSFlushCommands();
+		return false;
+	};
+	g_ctally.layers++;
+	return true;
+};
+
+static bool RGSRecordTileMap16(int in_x, int in_y, const RGSTile16* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent, uint32_t in_priorities) {
+	if (!g_deferred && g_bcount < 2) return false;
+	const uint8_t* const blend_data = RGSBlendTable();
+	if (!in_transparent && !blend_data && (in_priorities & RGS_TILE16_ALL) == RGS_TILE16_ALL && (in_hwrap || (in_x <= 0 && in_x + g_cwidth >= g_swidth)) && (in_vwrap || (in_y <= 0 && in_y + g_cheight >= g_sheight))) RGSSkipCommands();
+	RGSDrawCommand draw_command;
+	draw_command.type = RGS_DRAW_COMMAND_TYPE_TILEMAP16;
+	draw_command.patterns = g_pbanks[g_pselected].live;
+	draw_command.blend = blend_data;
+	draw_command.tilemap16.x = in_x;
+	draw_command.tilemap16.y = in_y;
+	draw_command.tilemap16.hwrap = in_hwrap;
+	draw_command.tilemap16.vwrap = in_vwrap;
+	draw_command.tilemap16.transparent = in_transparent;
+	draw_command.tilemap16.priorities = in_priorities;
+	if (!RGSCopyTileMap16(in_tiles, in_palettes, &draw_command.tilemap16.list, &draw_command.tilemap16.palettes) || !RGSRecordCommand(&draw_command)) {
+		RGSFlushCommands();
+		return false;
+	};
+	g_ctally.layers++;
+	return true;
+};
+
+static uint8_t* RGSFreeBankBuffer(int in_bank, const uint8_t* in_avoid) {
+	RGSPatternBankData* const pattern_bank = g_pbanks + in_bank;
+	uint8_t* const bank_data = g_pstore + (RGSBankSize() * (size_t)(in_bank));
+	if (bank_data != pattern_bank->live && bank_data != in_avoid) return bank_data;
+	if (!pattern_bank->spare) {
+		pattern_bank->spare = (uint8_t*)(malloc(RGSBankSize()));
+		if (!pattern_bank->spare) {
+			RGSReportWarning("Graphics", "Failed to allocate spare pattern bank");
+			return RGS_NULL;
+		};
+	};
+	return pattern_bank->spare != pattern_bank->live && pattern_bank->spare != in_avoid ? pattern_bank->spare : RGS_NULL;
+};
+
+static void RGSPublishPatternBanks() {
+	if (!RGSReadCounter(RGS_COUNTER_PASS(g_ppending))) return;
+	RGSActivateLock(RGS_LOCK_PASS(g_rlock));
+	for (int bank_index = 0; bank_index < g_pbcount; bank_index++) {
+		RGSPatternBankData* const pattern_bank = g_pbanks + bank_index;
+		if (!RGSReadCounter(RGS_COUNTER_PASS(pattern_bank->ready))) continue;
+		pattern_bank->live = pattern_bank->staged;
+		pattern_bank->staged = RGS_NULL;
+		RGSAddToCounter(RGS_COUNTER_PASS(pattern_bank->ready), -1L);
+		RGSAddToCounter(RGS_COUNTER_PASS(pattern_bank->loading), -1L);
+		RGSAddToCounter(RGS_COUNTER_PASS(g_ppending), -1L);
+	};
+	RGSDeactivateLock(RGS_LOCK_PASS(g_rlock));
+};
+
+static void RGSAdvancePatternAnimations(RGSTime in_time) {
+	for (int pattern_index = 0; pattern_index < 256; pattern_index++) {
+		const RGSPatternAnimation* const pattern_animation = g_panimations + pattern_index;
+		if (!pattern_animation->count) {
+			g_pframes[pattern_index] = (RGSPattern)(pattern_index);
+			continue;
+		};
+		const RGSTime elapsed_time = in_time > pattern_animation->started ? in_time - pattern_animation->started : 0ULL;
+		g_pframes[pattern_index] = pattern_animation->frames[(elapsed_time / pattern_animation->frame_time) % pattern_animation->count];
+	};
+};
+
+#if RGS_GRAPHICS_SIMD
+static bool RGSSupportsAVX2() {
+#if RGS_OS == RGS_OS_WINDOWS
+	int cpu_info[4];
+	__cpuid(cpu_info, 0);
+	if (cpu_info[0] < 7) return false;
+	__cpuid(cpu_info, 1);
+	if ((cpu_info[2] & (1 << 27)) == 0 || (cpu_info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 0x6ULL) != 0x6ULL) return false;
+	__cpuidex(cpu_info, 7, 0);
+	return (cpu_info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#endif
+};
+#endif
+
+
+#if RGS_OS == RGS_OS_WINDOWS
+static int RGSExpandedLength() {
+	const int line_size = g_depth == 2 ? ((g_swidth + 7) >> 3) << 2 : ((g_swidth * g_depth) + 7) >> 3;
+	const int line_padding = line_size % 4;
+	return line_size + (line_padding ? 4 - line_padding : 0);
 };
 
-static void RGSDrawTiles8(int in_x, int in_y, const RGSTile* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent) {
-	if (in_hwrap) in_x = in_x >= 0 ? (in_x % g_cwidth) : (g_cwidth + (in_x % g_cwidth));
-	if (in_vwrap) in_y = in_y >= 0 ? (in_y % g_cheight) : (g_cheight + (in_y % g_cheight));
-	const int layer_x_end = in_x + g_cwidth;
-	const int layer_y_end = in_y + g_cheight;
-	int layer_y = in_y;
-	do {
-		int pixel_y = layer_y;
-		if (in_vwrap) {
-			if (pixel_y >= g_cheight) pixel_y %= g_cheight;
-			if (pixel_y >= g_sheight) continue;
-		}
-		else {
-			if (pixel_y < 0) continue;
-			else if (pixel_y >= g_sheight) break;
+static const void* RGSExpandPixels() {
+	if (!g_expanded) return (const void*)(g_front);
+	const int expanded_length = RGSExpandedLength();
+	uint8_t* const packed_data = g_expanded + (expanded_length * g_sheight);
+	for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++) {
+		const uint8_t* pixel_data = g_front + (pixel_y * g_length);
+		uint8_t* expanded_data = g_expanded + (pixel_y * expanded_length);
+		if (g_bits != g_depth) {
+			if (g_depth != 2) {
+				RGSPackPixels(pixel_data, expanded_data, g_swidth);
+				continue;
+			};
+			RGSPackPixels(pixel_data, packed_data, g_swidth);
+			pixel_data = packed_data;
 		};
-		int tile_y = layer_y - in_y;
-		const int sample_y = tile_y & (g_pheight - 1);
-		tile_y /= g_pheight;
-		int layer_x = in_x;
+		const uint8_t* const pixel_end = pixel_data + ((g_swidth + 3) >> 2);
 		do {
-			int pixel_x = layer_x;
-			if (in_hwrap) {
-				if (pixel_x >= g_cwidth) pixel_x %= g_cwidth;
-				if (pixel_x >= g_swidth) continue;
-			}
-			else {
-				if (pixel_x < 0) continue;
-				else if (pixel_x >= g_swidth) break;
-			};
-			int tile_x = layer_x - in_x;
-			const int sample_x = tile_x & (g_pwidth - 1);
-			tile_x /= g_pwidth;
-			const RGSTile tile_data = in_tiles[tile_x + (tile_y * ((g_cwidth + (g_pwidth - 1)) / g_pwidth))];
-			const uint8_t* pattern_data = g_pdata + ((g_pwidth * g_pheight) * (size_t)(tile_data.pattern % g_pcount));
-			const uint8_t sample_data = pattern_data[(tile_data.hflip ? (g_pwidth - 1) - sample_x : sample_x) + ((tile_data.vflip ? (g_pheight - 1) - sample_y : sample_y) * g_pwidth)];
-			if (!in_transparent || sample_data) g_pixels[pixel_x + (pixel_y * g_length)] = (in_palettes && in_palettes[tile_data.palette]) ? in_palettes[tile_data.palette][sample_data] : sample_data;
+			const uint8_t sample_data = *pixel_data;
+			*(expanded_data++) = ((sample_data >> 2U) & 0b00110000U) | ((sample_data >> 4U) & 0b00000011U);
+			*(expanded_data++) = ((sample_data << 2U) & 0b00110000U) | (sample_data & 0b00000011U);
 		}
-		while (++layer_x < layer_x_end);
-	}
-	while (++layer_y < layer_y_end);
+		while (++pixel_data < pixel_end);
+	};
+	return (const void*)(g_expanded);
 };
 
+static bool RGSFrameChanged() {
+	if (!g_dfront || g_repaint) return true;
+	for (int cell_index = 0; cell_index < g_dcolumns * g_drows; cell_index++) {
+		if (g_dfront[cell_index] | g_dback[cell_index]) return true;
+	};
+	return false;
+};
 
-#if RGS_OS == RGS_OS_WINDOWS
 static LRESULT CALLBACK RGSUpdateGraphics(HWND in_window, UINT in_message, WPARAM in_wide, LPARAM in_long) {
 	switch (in_message) {
 	case WM_CLOSE: {
@@ -517,7 +2376,7 @@ static LRESULT CALLBACK RGSUpdateGraphics(HWND in_window, UINT in_message, WPARA
 						const float scaled_factor = (float)((int)(factor_x <= factor_y ? factor_x : factor_y));
 						const int scaled_width = (int)((float)(g_swidth) * scaled_factor);
 						const int scaled_height = (int)((float)(g_sheight) * scaled_factor);
-						StretchDIBits(surface_context, (surface_width >> 1) - (scaled_width >> 1), (surface_height >> 1) - (scaled_height >> 1), scaled_width, scaled_height, 0, 0, g_swidth, g_sheight, (const void*)(g_pixels), (LPBITMAPINFO)(g_bitmap), DIB_RGB_COLORS, SRCCOPY);
+						StretchDIBits(surface_context, (surface_width >> 1) - (scaled_width >> 1), (surface_height >> 1) - (scaled_height >> 1), scaled_width, scaled_height, 0, 0, g_swidth, g_sheight, RGSExpandPixels(), (LPBITMAPINFO)(g_eactive ? g_ebitmap : g_bitmap), DIB_RGB_COLORS, SRCCOPY);
 						BitBlt(paint_context, 0, 0, surface_width, surface_height, surface_context, 0, 0, SRCCOPY);
 						SelectObject(surface_context, surface_last);
 					};
@@ -570,26 +2429,106 @@ static bool RGSCreateGraphicsWindow(int in_icon, const char* in_title) {
 	};
 	return true;
 };
+#elif RGS_OS == RGS_OS_LINUX
+static void RGSCloseGraphics(int in_signal) {
+	(void)(in_signal);
+	g_closed = 1;
+};
+
+static bool RGSCreateGraphicsSurface() {
+	g_surface = (uint32_t*)(malloc((size_t)(g_swidth * g_sheight) * sizeof(*g_surface)));
+	if (!g_surface) {
+		RGSReportError("Graphics", "Failed to allocate surface", true);
+		return false;
+	};
+	signal(SIGINT, &RGSCloseGraphics);
+	signal(SIGTERM, &RGSCloseGraphics);
+	g_opened = RGSTimeNow();
+	return true;
+};
+
+static void RGSDestroyGraphicsSurface() {
+	const RGSTime elapsed_time = RGSTimeNow() - g_opened;
+	struct timespec processor_time = { 0 };
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &processor_time);
+	const double elapsed_seconds = (double)(elapsed_time) / (double)(RGS_ONE_SECOND);
+	const double processor_seconds = (double)(processor_time.tv_sec) + ((double)(processor_time.tv_nsec) / 1000000000.0);
+	const double frame_count = g_frames ? (double)(g_frames) : 1.0;
+	char report_message[256U];
+	snprintf(report_message, sizeof(report_message), "Presented %llu frames in %.3f seconds (%.2f per second), %.2f microseconds drawing and %.2f microseconds presenting per frame, %.3f seconds of processor time",
+		(unsigned long long)(g_frames), elapsed_seconds, elapsed_seconds > 0.0 ? (double)(g_frames) / elapsed_seconds : 0.0,
+		(double)(g_drawing) / frame_count, (double)(g_presenting) / frame_count, processor_seconds);
+	RGSReportInfo("Graphics", report_message);
+	free((void*)(g_surface));
+	g_surface = RGS_NULL;
+};
+
+static void RGSPresentSpan(int in_x, int in_y, int in_count) {
+	const uint8_t* const pixel_data = g_front + (in_y * g_length);
+	const RGSColour* const colour_data = g_eactive ? g_ecolours : g_palette;
+	uint32_t* surface_data = g_surface + in_x + (in_y * g_swidth);
+	const int pixel_end = in_x + in_count;
+	switch (g_bits) {
+	case 1:
+		for (int pixel_x = in_x; pixel_x < pixel_end; pixel_x++) *(surface_data++) = colour_data[(pixel_data[pixel_x >> 3] >> (7 - (pixel_x & 7))) & (g_colours - 1)];
+		break;
+	case 2:
+		for (int pixel_x = in_x; pixel_x < pixel_end; pixel_x++) *(surface_data++) = colour_data[(pixel_data[pixel_x >> 2] >> ((3 - (pixel_x & 3)) << 1)) & (g_colours - 1)];
+		break;
+	case 4:
+		for (int pixel_x = in_x; pixel_x < pixel_end; pixel_x++) *(surface_data++) = colour_data[((pixel_x & 1) ? pixel_data[pixel_x >> 1] : (pixel_data[pixel_x >> 1] >> 4U)) & (g_colours - 1)];
+		break;
+	case 8:
+		for (int pixel_x = in_x; pixel_x < pixel_end; pixel_x++) *(surface_data++) = colour_data[pixel_data[pixel_x] & (g_colours - 1)];
+		break;
+	};
+};
+
+static void RGSPresentGraphics() {
+	if (!g_dfront || g_repaint) {
+		g_repaint = false;
+		for (int pixel_y = 0; pixel_y < g_sheight; pixel_y++) RGSPresentSpan(0, pixel_y, g_swidth);
+		return;
+	};
+	for (int row_index = 0; row_index < g_drows; row_index++) {
+		const uint8_t* const front_data = g_dfront + (row_index * g_dcolumns);
+		const uint8_t* const back_data = g_dback + (row_index * g_dcolumns);
+		for (int column_index = 0; column_index < g_dcolumns; column_index++) {
+			if (!(front_data[column_index] | back_data[column_index])) continue;
+			const int column_start = column_index;
+			while (column_index < g_dcolumns && (front_data[column_index] | back_data[column_index])) column_index++;
+			for (int pixel_y = row_index * g_pheight; pixel_y < (row_index + 1) * g_pheight; pixel_y++) RGSPresentSpan(column_start * g_pwidth, pixel_y, (column_index - column_start) * g_pwidth);
+		};
+	};
+};
 #endif
 
 static void RGSGraphicsThreadJob(void* inout_parameters) {
 #if RGS_OS == RGS_OS_WINDOWS
 	RGSGraphicsThreadParameters* thread_parameters = (RGSGraphicsThreadParameters*)(inout_parameters);
 	if (!RGSCreateGraphicsWindow(thread_parameters->window_icon, thread_parameters->window_title))
+#elif RGS_OS == RGS_OS_LINUX
+	if (!RGSCreateGraphicsSurface())
 #endif
 	{
 		g_running = false;
 		RGSDeactivateLock(RGS_LOCK_PASS(g_lock));
 		return;
 	};
+#if RGS_OS == RGS_OS_WINDOWS
 	g_created = true;
+#endif
 	RGSDeactivateLock(RGS_LOCK_PASS(g_lock));
 	while (g_running && !g_started) { };
 	if (g_running) {
 		while (g_running) RGSRenderGraphics();
 	};
+#if RGS_OS == RGS_OS_WINDOWS
 	DestroyWindow(g_window);
 	UnregisterClassA(RGS_GRAPHICS_CLASS_NAME, g_instance);
+#elif RGS_OS == RGS_OS_LINUX
+	RGSDestroyGraphicsSurface();
+#endif
 };
 
 
@@ -637,19 +2576,26 @@ bool RGSPrepareGraphics(const RGSGameInfo* in_game, const RGSGraphicsInfo* in_gr
 		g_pcount = 256;
 		RGSReportWarning("Graphics", "Pattern count must be less than or equal to 256");
 	};
-	g_bits = (int)(in_graphics->bits_per_pixel);
-	if (g_bits != 1 && g_bits != 2 && g_bits != 4 && g_bits != 8) {
-		if (g_bits > 1) {
-			if (g_bits > 2) {
-				if (g_bits > 4) g_bits = 8;
-				else g_bits = 4;
+	for (int pattern_index = 0; pattern_index < 256; pattern_index++) g_pframes[pattern_index] = (RGSPattern)(pattern_index);
+	g_pbcount = in_graphics->pattern_banks ? (int)(in_graphics->pattern_banks) : 1;
+	if (g_pbcount < 0 || g_pbcount > RGS_GRAPHICS_BANK_LIMIT) {
+		g_pbcount = RGS_GRAPHICS_BANK_LIMIT;
+		RGSReportWarning("Graphics", "Pattern bank count must be less than or equal to 256");
+	};
+	g_depth = (int)(in_graphics->bits_per_pixel);
+	if (g_depth != 1 && g_depth != 2 && g_depth != 4 && g_depth != 8) {
+		if (g_depth > 1) {
+			if (g_depth > 2) {
+				if (g_depth > 4) g_depth = 8;
+				else g_depth = 4;
 			}
-			else g_bits = 2;
+			else g_depth = 2;
 		}
-		else g_bits = 1;
+		else g_depth = 1;
 		RGSReportWarning("Graphics", "Bits per pixel must be 1, 2, 4 or 8");
 	};
-	g_colours = 1 << g_bits;
+	g_colours = 1 << g_depth;
+	g_bits = (in_graphics->unpacked && g_depth < 8) ? 8 : g_depth;
 	g_rate = (RGSTime)(in_graphics->frame_rate);
 	if (!g_rate || g_rate > 60ULL) {
 		g_rate = 60ULL;
@@ -664,21 +2610,21 @@ bool RGSPrepareGraphics(const RGSGameInfo* in_game, const RGSGraphicsInfo* in_gr
 		g_read_pixels = &RGSReadPixels1;
 		g_write_pixels = &RGSWritePixels1;
 		g_draw_sprite = &RGSDrawSprite1;
+		g_draw_sprites = &RGSDrawSprites1;
 		g_draw_tiles = &RGSDrawTiles1;
+		g_draw_tilemap16 = &RGSDrawTileMap161;
 		break;
 	case 2:
-#if RGS_OS == RGS_OS_WINDOWS
-		g_bits = 4;
-#else
 		line_size = (g_swidth + 3) >> 2;
 		g_get_pixel = &RGSGetPixel2;
 		g_set_pixel = &RGSSetPixel2;
 		g_read_pixels = &RGSReadPixels2;
 		g_write_pixels = &RGSWritePixels2;
 		g_draw_sprite = &RGSDrawSprite2;
+		g_draw_sprites = &RGSDrawSprites2;
 		g_draw_tiles = &RGSDrawTiles2;
+		g_draw_tilemap16 = &RGSDrawTileMap162;
 		break;
-#endif
 	case 4:
 		line_size = (g_swidth + 1) >> 1;
 		g_get_pixel = &RGSGetPixel4;
@@ -686,7 +2632,9 @@ bool RGSPrepareGraphics(const RGSGameInfo* in_game, const RGSGraphicsInfo* in_gr
 		g_read_pixels = &RGSReadPixels4;
 		g_write_pixels = &RGSWritePixels4;
 		g_draw_sprite = &RGSDrawSprite4;
+		g_draw_sprites = &RGSDrawSprites4;
 		g_draw_tiles = &RGSDrawTiles4;
+		g_draw_tilemap16 = &RGSDrawTileMap164;
 		break;
 	case 8:
 		line_size = g_swidth;
@@ -695,29 +2643,72 @@ bool RGSPrepareGraphics(const RGSGameInfo* in_game, const RGSGraphicsInfo* in_gr
 		g_read_pixels = &RGSReadPixels8;
 		g_write_pixels = &RGSWritePixels8;
 		g_draw_sprite = &RGSDrawSprite8;
+		g_draw_sprites = &RGSDrawSprites8;
 		g_draw_tiles = &RGSDrawTiles8;
+		g_draw_tilemap16 = &RGSDrawTileMap168;
+		if (g_depth != 8) {
+			g_read_pixels = &RGSReadPixelsUnpacked;
+			g_write_pixels = &RGSWritePixelsUnpacked;
+		};
+#if RGS_GRAPHICS_SIMD
+		if (RGSSupportsAVX2()) {
+			g_draw_sprite = &RGSDrawSprite8AVX2;
+			g_draw_sprites = &RGSDrawSprites8AVX2;
+			g_draw_tiles = &RGSDrawTiles8AVX2;
+			g_draw_tilemap16 = &RGSDrawTileMap168AVX2;
+		}
+		else {
+			g_draw_sprite = &RGSDrawSprite8SSE2;
+			g_draw_sprites = &RGSDrawSprites8SSE2;
+			g_draw_tiles = &RGSDrawTiles8SSE2;
+			g_draw_tilemap16 = &RGSDrawTileMap168SSE2;
+		};
+#endif
 		break;
 	};
-	g_pdata = calloc((size_t)(((g_pwidth * g_bits) >> 3) * g_pheight * g_pcount), sizeof(*g_pdata));
-	if (!g_pdata) {
+#if RGS_GRAPHICS_SPECIALISED
+	const RGSDrawKernels* const kernel_set = RGSSpecialisedKernels();
+	g_draw_sprite = kernel_set->draw_sprite;
+	g_draw_sprites = kernel_set->draw_sprites;
+	g_draw_tiles = kernel_set->draw_tiles;
+	g_draw_tilemap16 = kernel_set->draw_tilemap16;
+#endif
+	g_pflipped = in_graphics->preflipped;
+	RGSPrepareConversions();
+	g_deferred = in_graphics->deferred;
+	g_pstore = (uint8_t*)(calloc(RGSBankSize() * (size_t)(g_pbcount), sizeof(*g_pstore)));
+	if (!g_pstore) {
 		RGSReportError("Graphics", "Failed to allocate patterns", true);
 		return false;
 	};
-#if RGS_OS == RGS_OS_WINDOWS
+	for (int bank_index = 0; bank_index < g_pbcount; bank_index++) g_pbanks[bank_index].live = g_pstore + (RGSBankSize() * (size_t)(bank_index));
+	g_pselected = 0U;
 	const int line_padding = line_size % 4;
 	g_length = line_size + (line_padding ? 4 - line_padding : 0);
-#endif
-	g_pixels = (uint8_t*)(malloc((size_t)(g_length * g_sheight) * sizeof(*g_pixels)));
-	if (!g_pixels) {
-		free((void*)(g_pdata));
+	g_buffers = (uint8_t*)(calloc((size_t)(g_length * g_sheight) * 2U, sizeof(*g_buffers)));
+	if (!g_buffers) {
+		free((void*)(g_pstore));
 		RGSReportError("Graphics", "Failed to allocate pixels", true);
 		return false;
 	};
+	g_pixels = g_buffers;
+	g_front = g_buffers + (g_length * g_sheight);
+	if (in_graphics->retained) {
+		g_dcolumns = g_swidth / g_pwidth;
+		g_drows = g_sheight / g_pheight;
+		g_dcells = (uint8_t*)(calloc((size_t)(g_dcolumns * g_drows) * 2U, sizeof(*g_dcells)));
+		if (g_dcells) {
+			g_dback = g_dcells;
+			g_dfront = g_dcells + (g_dcolumns * g_drows);
+		}
+		else RGSReportWarning("Graphics", "Failed to allocate dirty cells, the whole screen will be redrawn");
+	};
 #if RGS_OS == RGS_OS_WINDOWS
 	g_bitmap = (LPBITMAPINFO)(malloc(sizeof(*g_bitmap) + (sizeof(*g_bitmap->bmiColors) * ((size_t)(g_colours) - 1U))));
 	if (!g_bitmap) {
-		free((void*)(g_pixels));
-		free((void*)(g_pdata));
+		free((void*)(g_buffers));
+		free((void*)(g_dcells));
+		free((void*)(g_pstore));
 		RGSReportError("Graphics", "Failed to allocate bitmap", true);
 		return false;
 	};
@@ -725,50 +2716,108 @@ bool RGSPrepareGraphics(const RGSGameInfo* in_game, const RGSGraphicsInfo* in_gr
 	g_bitmap->bmiHeader.biWidth = (LONG)(g_swidth);
 	g_bitmap->bmiHeader.biHeight = -(LONG)(g_sheight);
 	g_bitmap->bmiHeader.biPlanes = 1U;
-	g_bitmap->bmiHeader.biBitCount = g_bits;
+	g_bitmap->bmiHeader.biBitCount = g_depth == 2 ? 4 : g_depth;
 	g_bitmap->bmiHeader.biCompression = BI_RGB;
 	g_bitmap->bmiHeader.biSizeImage = 0UL;
 	g_bitmap->bmiHeader.biXPelsPerMeter = 0L;
 	g_bitmap->bmiHeader.biYPelsPerMeter = 0L;
 	g_bitmap->bmiHeader.biClrUsed = (DWORD)(g_colours);
 	g_bitmap->bmiHeader.biClrImportant = (DWORD)(g_colours);
-	const BYTE colour_step = 255U / (BYTE)((1 << g_bits) - 1);
+	const BYTE colour_step = 255U / (BYTE)((1 << g_depth) - 1);
 	for (int colour_index = 0; colour_index < g_colours; colour_index++) {
 		const BYTE colour_value = (BYTE)(colour_index) * colour_step;
 		g_bitmap->bmiColors[colour_index] = (RGBQUAD){ colour_value, colour_value, colour_value, 0U };
 	};
+	if (g_depth == 2 || g_bits != g_depth) {
+		g_expanded = (uint8_t*)(calloc((size_t)(RGSExpandedLength() * (g_sheight + 1)), sizeof(*g_expanded)));
+		if (!g_expanded) {
+			free((void*)(g_bitmap));
+			free((void*)(g_buffers));
+			free((void*)(g_dcells));
+			free((void*)(g_pstore));
+			RGSReportError("Graphics", "Failed to allocate expanded pixels", true);
+			return false;
+		};
+	};
+#elif RGS_OS == RGS_OS_LINUX
+	g_palette = (RGSColour*)(malloc((size_t)(g_colours) * sizeof(*g_palette)));
+	if (!g_palette) {
+		free((void*)(g_buffers));
+		free((void*)(g_dcells));
+		free((void*)(g_pstore));
+		RGSReportError("Graphics", "Failed to allocate palette", true);
+		return false;
+	};
+	const uint8_t colour_step = 255U / (uint8_t)((1 << g_depth) - 1);
+	for (int colour_index = 0; colour_index < g_colours; colour_index++) {
+		const uint8_t colour_value = (uint8_t)(colour_index) * colour_step;
+		g_palette[colour_index] = RGS_COLOUR_MAKE(colour_value, colour_value, colour_value);
+	};
 #endif
+	g_rlock = RGSCreateLock(false);
 	g_lock = RGSCreateLock(true);
 	if (g_lock == RGS_LOCK_INVALID) {
 #if RGS_OS == RGS_OS_WINDOWS
+		free(g_expanded);
 		free(g_bitmap);
+#elif RGS_OS == RGS_OS_LINUX
+		free(g_palette);
 #endif
-		free(g_pixels);
-		free(g_pdata);
+		free(g_buffers);
+		free(g_dcells);
+		free((void*)(g_pstore));
 		RGSReportError("Graphics", "Failed to create lock", true);
 		return false;
 	};
 #if RGS_DEVICE == RGS_DEVICE_DESKTOP
+#if RGS_OS == RGS_OS_WINDOWS
 	RGSGraphicsThreadParameters thread_parameters = { in_graphics->window_icon, in_graphics->window_title };
+#else
+	RGSGraphicsThreadParameters thread_parameters = { in_graphics->window_title };
+#endif
 	g_thread = in_graphics->threaded ? RGSCreateThread(&RGSGraphicsThreadJob, RGS_LOCK_PASS(g_lock), &thread_parameters) : RGS_THREAD_INVALID;
 #endif
 	if (g_thread == RGS_THREAD_INVALID) {
 		if (in_graphics->threaded) RGSReportError("Graphics", "Failed to create thread", false);
-		if (!RGSCreateGraphicsWindow(in_graphics->window_icon, in_graphics->window_title)) {
 #if RGS_OS == RGS_OS_WINDOWS
+		if (!RGSCreateGraphicsWindow(in_graphics->window_icon, in_graphics->window_title)) {
 			free(g_bitmap);
+#elif RGS_OS == RGS_OS_LINUX
+		if (!RGSCreateGraphicsSurface()) {
+			free(g_palette);
 #endif
-			free(g_pixels);
-			free(g_pdata);
+			free(g_buffers);
+			free(g_dcells);
+			free((void*)(g_pstore));
 			return false;
 		};
+#if RGS_OS == RGS_OS_WINDOWS
 		g_created = true;
+#endif
 		RGSDeactivateLock(RGS_LOCK_PASS(g_lock));
 	};
+	const int band_limit = (g_sheight / g_pheight) < RGS_GRAPHICS_BAND_LIMIT ? (g_sheight / g_pheight) : RGS_GRAPHICS_BAND_LIMIT;
+	const int band_count = in_graphics->draw_threads < (uint32_t)(band_limit) ? (int)(in_graphics->draw_threads) : band_limit;
+	g_wrunning = true;
+	for (g_bcount = 1; g_bcount < band_count; g_bcount++) {
+		g_wlock = RGSCreateLock(true);
+		g_workers[g_bcount - 1] = RGSCreateThread(&RGSDrawWorkerJob, RGS_LOCK_PASS(g_wlock), (void*)((intptr_t)(g_bcount)));
+		if (g_workers[g_bcount - 1] == RGS_THREAD_INVALID) {
+			RGSReportWarning("Graphics", "Failed to create drawing thread, fewer bands will be drawn in parallel");
+			break;
+		};
+	};
 	return true;
 };
 
 void RGSReleaseGraphics() {
+	g_wrunning = false;
+	RGSAddToCounter(RGS_COUNTER_PASS(g_wgeneration), 1L);
+	RGSWakeCounterWaiters(RGS_COUNTER_PASS(g_wgeneration));
+	for (int worker_index = 0; worker_index < g_bcount - 1; worker_index++) {
+		RGSWaitForThread(RGS_THREAD_PASS(g_workers[worker_index]));
+		RGSDestroyThread(RGS_THREAD_PASS(g_workers[worker_index]));
+	};
 	if (g_thread) {
 		RGSActivateLock(RGS_LOCK_PASS(g_lock));
 		g_running = false;
@@ -780,14 +2829,55 @@ void RGSReleaseGraphics() {
 #if RGS_OS == RGS_OS_WINDOWS
 		DestroyWindow(g_window);
 		UnregisterClassA(RGS_GRAPHICS_CLASS_NAME, g_instance);
+#elif RGS_OS == RGS_OS_LINUX
+		if (g_surface) RGSDestroyGraphicsSurface();
 #endif
 	};
+	RGSDestroyLock(RGS_LOCK_PASS(g_rlock));
 	RGSDestroyLock(RGS_LOCK_PASS(g_lock));
 #if RGS_OS == RGS_OS_WINDOWS
+	free((void*)(g_expanded));
+	free((void*)(g_ebitmap));
 	free((void*)(g_bitmap));
+	g_ebitmap = NULL;
+#elif RGS_OS == RGS_OS_LINUX
+	free((void*)(g_ecolours));
+	free((void*)(g_palette));
+	g_ecolours = RGS_NULL;
 #endif
-	free((void*)(g_pixels));
-	free((void*)(g_pdata));
+	memset((void*)(g_ecycles), 0, sizeof(g_ecycles));
+	memset((void*)(&g_efade), 0, sizeof(g_efade));
+	memset((void*)(&g_eflash), 0, sizeof(g_eflash));
+	g_eactive = false;
+	for (int pattern_index = 0; pattern_index < 256; pattern_index++) free((void*)(g_panimations[pattern_index].frames));
+	memset((void*)(g_panimations), 0, sizeof(g_panimations));
+	while (g_afirst) {
+		RGSArenaBlock* const arena_block = g_afirst;
+		g_afirst = arena_block->next;
+		free((void*)(arena_block));
+	};
+	free((void*)(g_clist));
+	free((void*)(g_scells));
+	free((void*)(g_skeys));
+	free((void*)(g_dcells));
+	free((void*)(g_buffers));
+	free((void*)(g_pstore));
+	g_pstore = RGS_NULL;
+	free((void*)(g_lstore));
+	g_lstore = RGS_NULL;
+	g_lbank = RGS_NULL;
+	for (int mode_index = 0; mode_index < RGS_GRAPHICS_BLEND_MODES; mode_index++) {
+		free((void*)(g_mtables[mode_index]));
+		g_mtables[mode_index] = RGS_NULL;
+		g_mbuilt[mode_index] = 0U;
+	};
+	for (size_t release_index = 0U; release_index < g_arcount; release_index++) g_areleases[release_index].release(g_areleases[release_index].data);
+	free((void*)(g_areleases));
+	g_areleases = RGS_NULL;
+	g_arcount = 0U;
+	g_arcapacity = 0U;
+	for (int bank_index = 0; bank_index < g_pbcount; bank_index++) free((void*)(g_pbanks[bank_index].spare));
+	memset((void*)(g_pbanks), 0, sizeof(g_pbanks));
 };
 
 
@@ -807,18 +2897,46 @@ void RGSRenderGraphics() {
 		TranslateMessage(&message_info);
 		DispatchMessageA(&message_info);
 	};
+#elif RGS_OS == RGS_OS_LINUX
+	if (g_closed) g_running = false;
 #endif
 	const RGSTime current_time = RGSTimeNow();
 	if ((current_time - g_rendered) >= (RGS_ONE_SECOND / g_rate)) {
+		if (g_deferred) g_cleared = false;
+		else RGSClearPixels();
 		RGSActivateLock(RGS_LOCK_PASS(g_lock));
-		memset((void*)(g_pixels), 0, (size_t)(g_length * g_sheight) * sizeof(*g_pixels));
+		RGSPublishPatternBanks();
+		RGSAdvancePatternAnimations(current_time);
 		g_rendering = true;
 		RGSRender();
 		g_rendering = false;
+		RGSApplyColourEffects(current_time);
+		if (!g_deferred) {
+			RGSFlushCommands();
+			RGSSwapPixels();
+		}
+		else RGSActivateLock(RGS_LOCK_PASS(g_rlock));
 		RGSDeactivateLock(RGS_LOCK_PASS(g_lock));
+		if (g_deferred) {
+			RGSFlushCommands();
+			RGSDeactivateLock(RGS_LOCK_PASS(g_rlock));
+			RGSSwapPixels();
+		};
+		g_cstats = g_ctally;
+		memset((void*)(&g_ctally), 0, sizeof(g_ctally));
 #if RGS_OS == RGS_OS_WINDOWS
-		InvalidateRect(g_window, NULL, FALSE);
-		UpdateWindow(g_window);
+		if (RGSFrameChanged()) {
+			g_repaint = false;
+			InvalidateRect(g_window, NULL, FALSE);
+			UpdateWindow(g_window);
+		};
+#elif RGS_OS == RGS_OS_LINUX
+		const RGSTime drawn_time = RGSTimeNow();
+		RGSPresentGraphics();
+		const RGSTime presented_time = RGSTimeNow();
+		g_drawing += drawn_time - current_time;
+		g_presenting += presented_time - drawn_time;
+		g_frames++;
 #endif
 		g_rendered = current_time;
 	};
@@ -841,12 +2959,59 @@ bool RGSGraphicsThreaded() { return g_thread != RGS_THREAD_INVALID; };
 bool RGSGraphicsRunning() { return g_running; };
 
 
+bool RGSBindPatterns(uint8_t* inout_data, uint32_t in_count, uint32_t in_bits, uint32_t in_width, uint32_t in_height) {
+	if (!g_modifying || !inout_data || (in_bits != 1U && in_bits != 2U && in_bits != 4U && in_bits != 8U)) return false;
+	if (in_width != (uint32_t)(g_pwidth) || in_height != (uint32_t)(g_pheight)) {
+		RGSReportWarning("Graphics", "Pattern size doesn't match");
+		return false;
+	};
+	if (in_bits == (uint32_t)(g_bits) && g_bits == g_depth && !g_pflipped && in_count >= (uint32_t)(g_pcount)) {
+		RGSActivateLock(RGS_LOCK_PASS(g_rlock));
+		g_pbanks[g_pselected].live = inout_data;
+		RGSDeactivateLock(RGS_LOCK_PASS(g_rlock));
+		return true;
+	};
+	RGSUnbindPatterns(g_pbanks[g_pselected].live);
+	RGSWritePatterns(0U, in_count < (uint32_t)(g_pcount) ? in_count : (uint32_t)(g_pcount), in_bits, inout_data);
+	return true;
+};
+
+bool RGSUnbindPatterns(const uint8_t* in_data) {
+	if (!g_pstore || !in_data) return true;
+	if (!g_modifying) return false;
+	for (int bank_index = 0; bank_index < g_pbcount; bank_index++) {
+		RGSPatternBankData* const pattern_bank = g_pbanks + bank_index;
+		if (pattern_bank->live != in_data) continue;
+		while (RGSReadCounter(RGS_COUNTER_PASS(pattern_bank->loading)) && !RGSReadCounter(RGS_COUNTER_PASS(pattern_bank->ready))) RGSYieldThread();
+		RGSActivateLock(RGS_LOCK_PASS(g_rlock));
+		uint8_t* const bank_data = RGSFreeBankBuffer(bank_index, pattern_bank->staged);
+		if (bank_data) memcpy((void*)(bank_data), (const void*)(pattern_bank->live), RGSBankSize());
+		pattern_bank->live = bank_data ? bank_data : g_pstore + (RGSBankSize() * (size_t)(bank_index));
+		RGSDeactivateLock(RGS_LOCK_PASS(g_rlock));
+	};
+	return true;
+};
+
+bool RGSDeferRelease(void (*in_release)(void*), void* inout_data) {
+	if (!g_pstore) {
+		in_release(inout_data);
+		return true;
+	};
+	RGSActivateLock(RGS_LOCK_PASS(g_rlock));
+	const bool release_queued = RGSQueueRelease(in_release, inout_data);
+	RGSDeactivateLock(RGS_LOCK_PASS(g_rlock));
+	return release_queued;
+};
+
+
 /// Exposed Graphics Functions
 
 RGSColour RGSGetColour(uint8_t in_index) {
 	if (!g_modifying) return 0U;
 #if RGS_OS == RGS_OS_WINDOWS
 	return *((RGSColour*)(g_bitmap->bmiColors) + ((size_t)(in_index) % g_colours));
+#elif RGS_OS == RGS_OS_LINUX
+	return g_palette[(size_t)(in_index) % g_colours];
 #endif
 };
 
@@ -854,13 +3019,19 @@ void RGSSetColour(uint8_t in_index, RGSColour in_packed) {
 	if (!g_modifying) return;
 #if RGS_OS == RGS_OS_WINDOWS
 	*((RGSColour*)(g_bitmap->bmiColors) + ((size_t)(in_index) % g_colours)) = in_packed;
+#elif RGS_OS == RGS_OS_LINUX
+	g_palette[(size_t)(in_index) % g_colours] = in_packed;
 #endif
+	g_mversion++;
+	g_repaint = true;
 };
 
 void RGSReadColours(RGSColour* out_data) {
 	if (!g_modifying || !out_data) return;
 #if RGS_OS == RGS_OS_WINDOWS
 	memcpy(out_data, (const void*)(g_bitmap->bmiColors), (size_t)(g_colours) * sizeof(*g_bitmap->bmiColors));
+#elif RGS_OS == RGS_OS_LINUX
+	memcpy(out_data, (const void*)(g_palette), (size_t)(g_colours) * sizeof(*g_palette));
 #endif
 };
 
@@ -868,373 +3039,289 @@ void RGSWriteColours(const RGSColour* in_data) {
 	if (!g_modifying || !in_data) return;
 #if RGS_OS == RGS_OS_WINDOWS
 	memcpy((void*)(g_bitmap->bmiColors), in_data, (size_t)(g_colours) * sizeof(*g_bitmap->bmiColors));
+#elif RGS_OS == RGS_OS_LINUX
+	memcpy((void*)(g_palette), in_data, (size_t)(g_colours) * sizeof(*g_palette));
 #endif
+	g_mversion++;
+	g_repaint = true;
+};
+
+void RGSCycleColours(uint8_t in_cycle, uint8_t in_first, uint32_t in_count, RGSTime in_period, bool in_reverse) {
+	if (!g_modifying || in_cycle >= RGS_COLOUR_CYCLE_LIMIT) return;
+	const uint32_t colour_limit = (uint32_t)(g_colours) > (uint32_t)(in_first) ? (uint32_t)(g_colours) - (uint32_t)(in_first) : 0U;
+	const uint32_t colour_count = in_count < colour_limit ? in_count : colour_limit;
+	g_ecycles[in_cycle] = (RGSColourCycle){ RGSTimeNow(), in_period, (int)(in_first), in_period ? (int)(colour_count) : 0, in_reverse };
+};
+
+void RGSFadeColours(RGSColour in_colour, uint8_t in_level, RGSTime in_duration) {
+	if (!g_modifying) return;
+	const RGSTime current_time = RGSTimeNow();
+	g_efade = (RGSColourFade){ current_time, in_duration, in_colour, RGSFadeLevel(current_time), (int)(in_level) };
+};
+
+void RGSFlashColours(RGSColour in_colour, RGSTime in_attack, RGSTime in_hold, RGSTime in_release) {
+	if (!g_modifying) return;
+	g_eflash = (RGSColourFlash){ RGSTimeNow(), in_attack, in_hold, in_release, in_colour, true };
+};
+
+void RGSClearColourEffects() {
+	if (!g_modifying) return;
+	memset((void*)(g_ecycles), 0, sizeof(g_ecycles));
+	memset((void*)(&g_efade), 0, sizeof(g_efade));
+	memset((void*)(&g_eflash), 0, sizeof(g_eflash));
 };
 
 
 void RGSReadPattern(RGSPattern in_index, uint32_t in_bits, uint8_t* out_data) {
-	if (!g_modifying || !out_data) return;
-	const uint8_t* pattern_data;
-	switch (g_bits) {
-	case 1:
-		pattern_data = g_pdata + (((g_pwidth >> 3) * g_pheight) * (size_t)(in_index % g_pcount));
-		switch (in_bits) {
-		case 1U: {
-			memcpy(out_data, pattern_data, ((g_pwidth >> 3) * g_pheight) * sizeof(*pattern_data));
-			break;
-		};
-		case 2U: {
-			const uint8_t* const data_end = out_data + ((g_pwidth >> 2) * g_pheight);
-			do {
-				uint8_t sample_data = ((*pattern_data >> 7U) & ((1U << 1U) - 1U)) << 6U;
-				sample_data |= ((*pattern_data >> 6U) & ((1U << 1U) - 1U)) << 4U;
-				sample_data |= ((*pattern_data >> 5U) & ((1U << 1U) - 1U)) << 2U;
-				*(out_data++) = sample_data | ((*pattern_data >> 4U) & ((1U << 1U) - 1U));
-				sample_data = ((*pattern_data >> 3U) & ((1U << 1U) - 1U)) << 6U;
-				sample_data |= ((*pattern_data >> 2U) & ((1U << 1U) - 1U)) << 4U;
-				sample_data |= ((*pattern_data >> 1U) & ((1U << 1U) - 1U)) << 2U;
-				*(out_data++) = sample_data | (*(pattern_data++) & ((1U << 1U) - 1U));
-			}
-			while (out_data < data_end);
-			break;
-		};
-		case 4U: {
-			const uint8_t* const data_end = out_data + ((g_pwidth >> 1) * g_pheight);
-			do {
-				uint8_t sample_data = ((*pattern_data >> 7U) & ((1U << 1U) - 1U)) << 4U;
-				*(out_data++) = sample_data | ((*pattern_data >> 6U) & ((1U << 1U) - 1U));
-				sample_data = ((*pattern_data >> 5U) & ((1U << 1U) - 1U)) << 4U;
-				*(out_data++) = sample_data | ((*pattern_data >> 4U) & ((1U << 1U) - 1U));
-				sample_data = ((*pattern_data >> 3U) & ((1U << 1U) - 1U)) << 4U;
-				*(out_data++) = sample_data | ((*pattern_data >> 2U) & ((1U << 1U) - 1U));
-				sample_data = ((*pattern_data >> 1U) & ((1U << 1U) - 1U)) << 4U;
-				*(out_data++) = sample_data | (*(pattern_data++) & ((1U << 1U) - 1U));
-			}
-			while (out_data < data_end);
-			break;
-		};
-		case 8U: {
-			const uint8_t* const data_end = out_data + (g_pwidth * g_pheight);
-			do {
-				*(out_data++) = (*pattern_data >> 7U) & ((1U << 1U) - 1U);
-				*(out_data++) = (*pattern_data >> 6U) & ((1U << 1U) - 1U);
-				*(out_data++) = (*pattern_data >> 5U) & ((1U << 1U) - 1U);
-				*(out_data++) = (*pattern_data >> 4U) & ((1U << 1U) - 1U);
-				*(out_data++) = (*pattern_data >> 3U) & ((1U << 1U) - 1U);
-				*(out_data++) = (*pattern_data >> 2U) & ((1U << 1U) - 1U);
-				*(out_data++) = (*pattern_data >> 1U) & ((1U << 1U) - 1U);
-				*(out_data++) = *(pattern_data++) & ((1U << 1U) - 1U);
-			}
-			while (out_data < data_end);
-			break;
-		};
-		};
-		break;
-	case 2:
-		pattern_data = g_pdata + (((g_pwidth >> 2) * g_pheight) * (size_t)(in_index % g_pcount));
-		switch (in_bits) {
-		case 1U: break;
-		case 2U: {
-			memcpy(out_data, pattern_data, ((g_pwidth >> 2) * g_pheight) * sizeof(*pattern_data));
-			break;
-		};
-		case 4U: break;
-		case 8U: break;
-		};
-		break;
-	case 4:
-		pattern_data = g_pdata + (((g_pwidth >> 1) * g_pheight) * (size_t)(in_index % g_pcount));
-		switch (in_bits) {
-		case 1U: {
-			const uint8_t* const data_end = out_data + ((g_pwidth >> 3) * g_pheight);
-			do {
-				uint8_t sample_data = ((*pattern_data >> 4U) & ((1U << 1U) - 1U)) << 7U;
-				sample_data |= (*(pattern_data++) & ((1U << 1U) - 1U)) << 6U;
-				sample_data |= ((*pattern_data >> 4U) & ((1U << 1U) - 1U)) << 5U;
-				sample_data |= (*(pattern_data++) & ((1U << 1U) - 1U)) << 4U;
-				sample_data |= ((*pattern_data >> 4U) & ((1U << 1U) - 1U)) << 3U;
-				sample_data |= (*(pattern_data++) & ((1U << 1U) - 1U)) << 2U;
-				sample_data |= ((*pattern_data >> 4U) & ((1U << 1U) - 1U)) << 1U;
-				*out_data = sample_data | (*(pattern_data++) & ((1U << 1U) - 1U));
-			}
-			while (++out_data < data_end);
-			break;
-		};
-		case 2U: {
-			const uint8_t* const data_end = out_data + ((g_pwidth >> 2) * g_pheight);
-			do {
-				uint8_t sample_data = ((*pattern_data >> 4U) & ((1U << 2U) - 1U)) << 6U;
-				sample_data |= (*(pattern_data++) & ((1U << 2U) - 1U)) << 4U;
-				sample_data |= ((*pattern_data >> 4U) & ((1U << 2U) - 1U)) << 2U;
-				*out_data = sample_data | (*(pattern_data++) & ((1U << 2U) - 1U));
-			}
-			while (++out_data < data_end);
-			break;
-		};
-		case 4U: {
-			memcpy(out_data, pattern_data, ((g_pwidth >> 1) * g_pheight) * sizeof(*pattern_data));
-			break;
-		};
-		case 8U: {
-			const uint8_t* const data_end = out_data + (g_pwidth * g_pheight);
-			do {
-				const uint8_t sample_data = *(pattern_data++);
-				*(out_data++) = (sample_data >> 4U) & ((1U << 8U) - 1U);
-				*(out_data++) = sample_data & ((1U << 8U) - 1U);
-			}
-			while (out_data < data_end);
-			break;
-		};
-		};
-		break;
-	case 8:
-		pattern_data = g_pdata + ((g_pwidth * g_pheight) * (size_t)(in_index % g_pcount));
-		switch (in_bits) {
-		case 1U: {
-			const uint8_t* const data_end = out_data + ((g_pwidth >> 3) * g_pheight);
-			do {
-				uint8_t sample_data = (*(pattern_data++) & ((1U << 1U) - 1U)) << 7U;
-				sample_data |= (*(pattern_data++) & ((1U << 1U) - 1U)) << 6U;
-				sample_data |= (*(pattern_data++) & ((1U << 1U) - 1U)) << 5U;
-				sample_data |= (*(pattern_data++) & ((1U << 1U) - 1U)) << 4U;
-				sample_data |= (*(pattern_data++) & ((1U << 1U) - 1U)) << 3U;
-				sample_data |= (*(pattern_data++) & ((1U << 1U) - 1U)) << 2U;
-				sample_data |= (*(pattern_data++) & ((1U << 1U) - 1U)) << 1U;
-				*out_data = sample_data | (*(pattern_data++) & ((1U << 1U) - 1U));
-			}
-			while (++out_data < data_end);
-			break;
-		};
-		case 2U: {
-			const uint8_t* const data_end = out_data + ((g_pwidth >> 2) * g_pheight);
-			do {
-				uint8_t sample_data = (*(pattern_data++) & ((1U << 2U) - 1U)) << 6U;
-				sample_data |= (*(pattern_data++) & ((1U << 2U) - 1U)) << 4U;
-				sample_data |= (*(pattern_data++) & ((1U << 2U) - 1U)) << 2U;
-				*out_data = sample_data | (*(pattern_data++) & ((1U << 2U) - 1U));
-			}
-			while (++out_data < data_end);
-			break;
-		};
-		case 4U: {
-			const uint8_t* const data_end = out_data + ((g_pwidth >> 1) * g_pheight);
-			do {
-				const uint8_t sample_data = (*(pattern_data++) & ((1U << 4U) - 1U)) << 4U;
-				*out_data = sample_data | (*(pattern_data++) & ((1U << 4U) - 1U));
-			}
-			while (++out_data < data_end);
-			break;
-		};
-		case 8U: {
-			memcpy(out_data, pattern_data, (g_pwidth * g_pheight) * sizeof(*pattern_data));
-			break;
-		};
-		};
-		break;
+	if (!g_modifying || !out_data || (in_bits != 1U && in_bits != 2U && in_bits != 4U && in_bits != 8U)) return;
+	const size_t sample_count = (size_t)(g_pwidth * g_pheight);
+	RGSConvertSamples(g_pbanks[g_pselected].live + (((sample_count * (size_t)(g_bits)) >> 3) * RGSPatternSlot(in_index)), g_bits, out_data, (int)(in_bits), sample_count);
+};
+
+void RGSWritePattern(RGSPattern in_index, uint32_t in_bits, const uint8_t* in_data) { RGSWritePatterns(in_index, 1U, in_bits, in_data); };
+
+void RGSWritePatterns(RGSPattern in_first, uint32_t in_count, uint32_t in_bits, const uint8_t* in_data) {
+	if (!g_modifying || !in_data || (in_bits != 1U && in_bits != 2U && in_bits != 4U && in_bits != 8U)) return;
+	RGSActivateLock(RGS_LOCK_PASS(g_rlock));
+	RGSConvertPatterns(g_pbanks[g_pselected].live, in_first, in_count, in_bits, in_data);
+	RGSDeactivateLock(RGS_LOCK_PASS(g_rlock));
+};
+
+
+void RGSSelectPatternBank(RGSPatternBank in_bank) {
+	if ((!g_modifying && !g_rendering) || in_bank >= g_pbcount) return;
+	g_pselected = in_bank;
+};
+
+RGSPatternBank RGSGetPatternBank() { return g_pselected; };
+
+bool RGSLoadPatternBank(RGSPatternBank in_bank, uint32_t in_count, uint32_t in_bits, const uint8_t* in_data) {
+	if (!g_pstore || in_bank >= g_pbcount || !in_data || (in_bits != 1U && in_bits != 2U && in_bits != 4U && in_bits != 8U)) return false;
+	RGSPatternBankData* const pattern_bank = g_pbanks + in_bank;
+	if (RGSAddToCounter(RGS_COUNTER_PASS(pattern_bank->loading), 1L) != 1L) {
+		RGSAddToCounter(RGS_COUNTER_PASS(pattern_bank->loading), -1L);
+		return false;
+	};
+	uint8_t* const bank_data = RGSFreeBankBuffer(in_bank, RGS_NULL);
+	if (!bank_data) {
+		RGSAddToCounter(RGS_COUNTER_PASS(pattern_bank->loading), -1L);
+		return false;
 	};
+	const uint32_t pattern_count = in_count < (uint32_t)(g_pcount) ? in_count : (uint32_t)(g_pcount);
+	const size_t loaded_size = ((((size_t)(g_pwidth * g_pheight) * (size_t)(g_bits)) >> 3) * (size_t)(pattern_count)) << (g_pflipped ? 2U : 0U);
+	RGSConvertPatterns(bank_data, 0U, pattern_count, in_bits, in_data);
+	if (loaded_size < RGSBankSize()) memset((void*)(bank_data + loaded_size), 0, RGSBankSize() - loaded_size);
+	pattern_bank->staged = bank_data;
+	RGSAddToCounter(RGS_COUNTER_PASS(pattern_bank->ready), 1L);
+	RGSAddToCounter(RGS_COUNTER_PASS(g_ppending), 1L);
+	return true;
 };
 
-void RGSWritePattern(RGSPattern in_index, uint32_t in_bits, const uint8_t* in_data) {
-	if (!g_modifying || !in_data) return;
-	uint8_t* pattern_data;
-	switch (g_bits) {
-	case 1:
-		pattern_data = g_pdata + (((g_pwidth >> 3) * g_pheight) * (size_t)(in_index % g_pcount));
-		switch (in_bits) {
-		case 1U: {
-			memcpy(pattern_data, in_data, ((g_pwidth >> 3) * g_pheight) * sizeof(*pattern_data));
-			break;
-		};
-		case 2U: {
-			const uint8_t* const data_end = in_data + ((g_pwidth >> 2) * g_pheight);
-			do {
-				uint8_t sample_data = *(in_data++);
-				*pattern_data = ((sample_data >> 6U) & ((1U << 1U) - 1U)) << 7U;
-				*pattern_data |= ((sample_data >> 4U) & ((1U << 1U) - 1U)) << 6U;
-				*pattern_data |= ((sample_data >> 2U) & ((1U << 1U) - 1U)) << 5U;
-				*pattern_data |= (sample_data & ((1U << 1U) - 1U)) << 4U;
-				sample_data = *(in_data++);
-				*pattern_data |= ((sample_data >> 6U) & ((1U << 1U) - 1U)) << 3U;
-				*pattern_data |= ((sample_data >> 4U) & ((1U << 1U) - 1U)) << 2U;
-				*pattern_data |= ((sample_data >> 2U) & ((1U << 1U) - 1U)) << 1U;
-				*(pattern_data++) |= sample_data & ((1U << 1U) - 1U);
-			}
-			while (in_data < data_end);
-			break;
-		};
-		case 4U: {
-			const uint8_t* const data_end = in_data + ((g_pwidth >> 1) * g_pheight);
-			do {
-				uint8_t sample_data = *(in_data++);
-				*pattern_data = ((sample_data >> 4U) & ((1U << 1U) - 1U)) << 7U;
-				*pattern_data |= (sample_data & ((1U << 1U) - 1U)) << 6U;
-				sample_data = *(in_data++);
-				*pattern_data |= ((sample_data >> 4U) & ((1U << 1U) - 1U)) << 5U;
-				*pattern_data |= (sample_data & ((1U << 1U) - 1U)) << 4U;
-				sample_data = *(in_data++);
-				*pattern_data |= ((sample_data >> 4U) & ((1U << 1U) - 1U)) << 3U;
-				*pattern_data |= (sample_data & ((1U << 1U) - 1U)) << 2U;
-				sample_data = *(in_data++);
-				*pattern_data |= ((sample_data >> 4U) & ((1U << 1U) - 1U)) << 1U;
-				*(pattern_data++) |= sample_data & ((1U << 1U) - 1U);
-			}
-			while (in_data < data_end);
-			break;
-		};
-		case 8U: {
-			const uint8_t* const data_end = in_data + (g_pwidth * g_pheight);
-			do {
-				*pattern_data = (*(in_data++) & ((1U << 1U) - 1U)) << 7U;
-				*pattern_data |= (*(in_data++) & ((1U << 1U) - 1U)) << 6U;
-				*pattern_data |= (*(in_data++) & ((1U << 1U) - 1U)) << 5U;
-				*pattern_data |= (*(in_data++) & ((1U << 1U) - 1U)) << 4U;
-				*pattern_data |= (*(in_data++) & ((1U << 1U) - 1U)) << 3U;
-				*pattern_data |= (*(in_data++) & ((1U << 1U) - 1U)) << 2U;
-				*pattern_data |= (*(in_data++) & ((1U << 1U) - 1U)) << 1U;
-				*(pattern_data++) |= *(in_data++) & ((1U << 1U) - 1U);
-			}
-			while (in_data < data_end);
-			break;
-		};
-		};
-		break;
-	case 2:
-		pattern_data = g_pdata + (((g_pwidth >> 2) * g_pheight) * (size_t)(in_index % g_pcount));
-		switch (in_bits) {
-		case 1U: break;
-		case 2U: {
-			memcpy(pattern_data, in_data, ((g_pwidth >> 2) * g_pheight) * sizeof(*pattern_data));
-			break;
-		};
-		case 4U: break;
-		case 8U: break;
-		};
-		break;
-	case 4:
-		pattern_data = g_pdata + (((g_pwidth >> 1) * g_pheight) * (size_t)(in_index % g_pcount));
-		switch (in_bits) {
-		case 1U: {
-			const uint8_t* const data_end = in_data + ((g_pwidth >> 3) * g_pheight);
-			do {
-				const uint8_t sample_data = *in_data;
-				*pattern_data = ((sample_data >> 7U) & ((1U << 1U) - 1U)) << 4U;
-				*(pattern_data++) |= (sample_data >> 6U) & ((1U << 1U) - 1U);
-				*pattern_data = ((sample_data >> 5U) & ((1U << 1U) - 1U)) << 4U;
-				*(pattern_data++) |= (sample_data >> 4U) & ((1U << 1U) - 1U);
-				*pattern_data = ((sample_data >> 3U) & ((1U << 1U) - 1U)) << 4U;
-				*(pattern_data++) |= (sample_data >> 2U) & ((1U << 1U) - 1U);
-				*pattern_data = ((sample_data >> 1U) & ((1U << 1U) - 1U)) << 4U;
-				*(pattern_data++) |= sample_data & ((1U << 1U) - 1U);
-			}
-			while (++in_data < data_end);
-			break;
-		};
-		case 2U: {
-			const uint8_t* const data_end = in_data + ((g_pwidth >> 2) * g_pheight);
-			do {
-				const uint8_t sample_data = *in_data;
-				*pattern_data = ((sample_data >> 6U) & ((1U << 2U) - 1U)) << 4;
-				*(pattern_data++) |= (sample_data >> 4U) & ((1U << 2U) - 1U);
-				*pattern_data = ((sample_data >> 2U) & ((1U << 2U) - 1U)) << 4;
-				*(pattern_data++) |= sample_data & ((1U << 2U) - 1U);
-			}
-			while (++in_data < data_end);
-			break;
-		};
-		case 4U: {
-			memcpy(pattern_data, in_data, ((g_pwidth >> 1) * g_pheight) * sizeof(*pattern_data));
-			break;
-		};
-		case 8U: {
-			const uint8_t* const data_end = in_data + (g_pwidth * g_pheight);
-			do {
-				*pattern_data = *(in_data++) << 4U;
-				*(pattern_data++) |= *(in_data++);
-			}
-			while (in_data < data_end);
-			break;
-		};
-		};
-		break;
-	case 8:
-		pattern_data = g_pdata + ((g_pwidth * g_pheight) * (size_t)(in_index % g_pcount));
-		switch (in_bits) {
-		case 1U: {
-			const uint8_t* const data_end = in_data + ((g_pwidth >> 3) * g_pheight);
-			do {
-				const uint8_t sample_data = *in_data;
-				*(pattern_data++) = (sample_data >> 7U) & ((1U << 1U) - 1U);
-				*(pattern_data++) = (sample_data >> 6U) & ((1U << 1U) - 1U);
-				*(pattern_data++) = (sample_data >> 5U) & ((1U << 1U) - 1U);
-				*(pattern_data++) = (sample_data >> 4U) & ((1U << 1U) - 1U);
-				*(pattern_data++) = (sample_data >> 3U) & ((1U << 1U) - 1U);
-				*(pattern_data++) = (sample_data >> 2U) & ((1U << 1U) - 1U);
-				*(pattern_data++) = (sample_data >> 1U) & ((1U << 1U) - 1U);
-				*(pattern_data++) = sample_data & ((1U << 1U) - 1U);
-			}
-			while (++in_data < data_end);
-			break;			
-		};
-		case 2U: {
-			const uint8_t* const data_end = in_data + ((g_pwidth >> 2) * g_pheight);
-			do {
-				const uint8_t sample_data = *in_data;
-				*(pattern_data++) = (sample_data >> 6U) & ((1U << 2U) - 1U);
-				*(pattern_data++) = (sample_data >> 4U) & ((1U << 2U) - 1U);
-				*(pattern_data++) = (sample_data >> 2U) & ((1U << 2U) - 1U);
-				*(pattern_data++) = sample_data & ((1U << 2U) - 1U);
-			}
-			while (++in_data < data_end);
-			break;
-		};
-		case 4U: {
-			const uint8_t* const data_end = in_data + ((g_pwidth >> 1) * g_pheight);
-			do {
-				const uint8_t sample_data = *in_data;
-				*(pattern_data++) = (sample_data >> 4U) & ((1U << 4U) - 1U);
-				*(pattern_data++) = sample_data & ((1U << 4U) - 1U);
-			}
-			while (++in_data < data_end);
-			break;
-		};
-		case 8U: {
-			memcpy(pattern_data, in_data, (g_pwidth * g_pheight) * sizeof(*pattern_data));
-			break;
-		};
+bool RGSPatternBankLoaded(RGSPatternBank in_bank) { return in_bank < g_pbcount && !RGSReadCounter(RGS_COUNTER_PASS(g_pbanks[in_bank].loading)); };
+
+void RGSSetPatternAnimation(RGSPattern in_base, const RGSPattern* in_frames, uint32_t in_count, RGSTime in_frame_time) {
+	if (!g_modifying) return;
+	RGSPatternAnimation* const pattern_animation = g_panimations + in_base;
+	if (!in_frames || in_count < 2U || !in_frame_time) {
+		pattern_animation->count = 0U;
+		return;
+	};
+	if (in_count > pattern_animation->count || !pattern_animation->frames) {
+		RGSPattern* const frame_data = (RGSPattern*)(realloc((void*)(pattern_animation->frames), (size_t)(in_count) * sizeof(*frame_data)));
+		if (!frame_data) {
+			RGSReportWarning("Graphics", "Failed to allocate pattern animation");
+			return;
 		};
-		break;
+		pattern_animation->frames = frame_data;
+	};
+	memcpy((void*)(pattern_animation->frames), (const void*)(in_frames), (size_t)(in_count) * sizeof(*in_frames));
+	pattern_animation->started = RGSTimeNow();
+	pattern_animation->frame_time = in_frame_time;
+	pattern_animation->count = in_count;
+};
+
+bool RGSWritePaletteBank(uint8_t in_first, uint32_t in_count, const RGSPalette* in_palettes) {
+	if (!g_modifying || !in_palettes || in_count > 256U - (uint32_t)(in_first) || !RGSReservePaletteBank()) return false;
+	RGSActivateLock(RGS_LOCK_PASS(g_rlock));
+	for (uint32_t palette_index = 0U; palette_index < in_count; palette_index++) {
+		if (in_palettes[palette_index]) memcpy((void*)(g_lbank + (((size_t)(in_first) + palette_index) * g_lstride)), (const void*)(in_palettes[palette_index]), (size_t)(g_colours));
 	};
+	RGSDeactivateLock(RGS_LOCK_PASS(g_rlock));
+	return true;
+};
+
+RGSPaletteBank RGSGetPaletteBank() { return RGSReservePaletteBank() ? (RGSPaletteBank)(g_llist) : RGS_NULL; };
+
+RGSPalette RGSGetBankPalette(uint8_t in_index) { return RGSReservePaletteBank() ? g_llist[in_index] : RGS_NULL; };
+
+
+void RGSSelectBlendMode(RGSBlendMode in_mode) {
+	if ((!g_modifying && !g_rendering) || in_mode >= RGS_GRAPHICS_BLEND_MODES) return;
+	g_mselected = in_mode;
+	RGSBlendTable();
 };
 
+RGSBlendMode RGSGetBlendMode() { return g_mselected; };
+
 
 uint8_t RGSGetPixel(int in_x, int in_y) {
 	if (!g_rendering || in_x < 0 || in_x >= g_swidth || in_y < 0 || in_y >= g_sheight) return 0U;
+	RGSFlushCommands();
 	return g_get_pixel(in_x, in_y);
 };
 
 void RGSSetPixel(int in_x, int in_y, uint8_t in_index) {
 	if (!g_rendering || in_x < 0 || in_x >= g_swidth || in_y < 0 || in_y >= g_sheight) return;
+	if (RGSRecordPixel(in_x, in_y, in_index)) return;
+	if (g_dback) RGSMarkDirty(in_x, in_y, 1, 1);
 	g_set_pixel(in_x, in_y, in_index);
 };
 
 void RGSReadPixels(uint8_t* out_pixels) {
 	if (!g_rendering || !out_pixels) return;
+	RGSFlushCommands();
 	g_read_pixels(out_pixels);
 };
 
 void RGSWritePixels(const uint8_t* in_pixels) {
 	if (!g_rendering || !in_pixels) return;
+	RGSSkipCommands();
+	RGSFlushCommands();
+	if (g_dback) RGSMarkDirty(0, 0, g_swidth, g_sheight);
 	g_write_pixels(in_pixels);
 };
 
+void RGSReadPixelsRect(int in_x, int in_y, int in_width, int in_height, uint8_t* out_pixels) {
+	if (!g_rendering || !out_pixels || in_width <= 0 || in_height <= 0 || in_x < 0 || in_y < 0 || in_width > g_swidth - in_x || in_height > g_sheight - in_y) return;
+	RGSFlushCommands();
+	RGSReadPixelRows(in_x, in_y, in_width, in_height, out_pixels);
+};
+
+void RGSWritePixelsRect(int in_x, int in_y, int in_width, int in_height, const uint8_t* in_pixels) {
+	if (!g_rendering || !in_pixels || in_width <= 0 || in_height <= 0 || in_x < 0 || in_y < 0 || in_width > g_swidth - in_x || in_height > g_sheight - in_y) return;
+	if (in_x == 0 && in_y == 0 && in_width == g_swidth && in_height == g_sheight) RGSSkipCommands();
+	RGSFlushCommands();
+	if (g_dback) RGSMarkDirty(in_x, in_y, in_width, in_height);
+	RGSWritePixelRows(in_x, in_y, in_width, in_height, in_pixels);
+};
+
+bool RGSLockFramebuffer(RGSFramebuffer* out_framebuffer) {
+	if (!g_rendering || !out_framebuffer) return false;
+	RGSFlushCommands();
+	if (g_dback) RGSMarkDirty(0, 0, g_swidth, g_sheight);
+	out_framebuffer->pixels = g_pixels;
+	out_framebuffer->pitch = (size_t)(g_length);
+	out_framebuffer->width = (uint32_t)(g_swidth);
+	out_framebuffer->height = (uint32_t)(g_sheight);
+	out_framebuffer->bits_per_pixel = (uint32_t)(g_bits);
+	return true;
+};
+
 
 void RGSDrawSprite(int in_x, int in_y, RGSPattern in_pattern, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap) {
 	if (!g_rendering) return;
-	g_draw_sprite(in_x, in_y, in_pattern, in_palette, in_hflip, in_vflip, in_hwrap, in_vwrap);
+	const RGSSpriteDesc sprite_desc = { in_x, in_y, in_pattern, in_palette, in_hflip, in_vflip, in_hwrap, in_vwrap };
+	if (RGSRecordSprites(&sprite_desc, 1U, false)) return;
+	g_pdata = g_pbanks[g_pselected].live;
+	g_mdata = RGSBlendTable();
+	g_draw_sprite(in_x, in_y, in_pattern, in_palette, in_hflip, in_vflip, in_hwrap, in_vwrap, 0, g_sheight);
+};
+
+void RGSDrawSprites(const RGSSpriteDesc* in_sprites, size_t in_count, bool in_sort) {
+	if (!g_rendering || !in_sprites) return;
+	if (RGSRecordSprites(in_sprites, in_count, in_sort)) return;
+	if (in_sort && !RGSReserveSpriteKeys(in_count)) in_sort = false;
+	g_pdata = g_pbanks[g_pselected].live;
+	g_mdata = RGSBlendTable();
+	g_draw_sprites(in_sprites, in_count, in_sort, 0, g_sheight);
 };
 
 void RGSDrawTiles(int in_x, int in_y, const RGSTile* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent) {
 	if (!g_rendering || !in_tiles) return;
-	g_draw_tiles(in_x, in_y, in_tiles, in_palettes, in_hwrap, in_vwrap, in_transparent);
+	if (RGSRecordTiles(in_x, in_y, in_tiles, in_palettes, in_hwrap, in_vwrap, in_transparent)) return;
+	g_pdata = g_pbanks[g_pselected].live;
+	g_mdata = RGSBlendTable();
+	g_draw_tiles(in_x, in_y, in_tiles, in_palettes, in_hwrap, in_vwrap, in_transparent, 0, g_sheight);
+};
+
+void RGSDrawTileMap16(int in_x, int in_y, const RGSTile16* in_tiles, const RGSPalette* in_palettes, bool in_hwrap, bool in_vwrap, bool in_transparent, uint32_t in_priorities) {
+	if (!g_rendering || !in_tiles || !(in_priorities & RGS_TILE16_ALL)) return;
+	if (RGSRecordTileMap16(in_x, in_y, in_tiles, in_palettes, in_hwrap, in_vwrap, in_transparent, in_priorities)) return;
+	g_pdata = g_pbanks[g_pselected].live;
+	g_mdata = RGSBlendTable();
+	g_draw_tilemap16(in_x, in_y, in_tiles, in_palettes, in_hwrap, in_vwrap, in_transparent, in_priorities, 0, g_sheight);
+};
+
+void RGSDrawBitmap(int in_x, int in_y, const RGSBitmap* in_bitmap, RGSPalette in_palette, bool in_hflip, bool in_vflip, bool in_hwrap, bool in_vwrap) {
+	if (!g_rendering || !in_bitmap || !in_bitmap->pixels || !in_bitmap->width || !in_bitmap->height || in_bitmap->width > 0xFFFFU || in_bitmap->height > 0xFFFFU) return;
+	if (in_bitmap->bits_per_pixel != 1U && in_bitmap->bits_per_pixel != 2U && in_bitmap->bits_per_pixel != 4U && in_bitmap->bits_per_pixel != 8U) return;
+	if (RGSRecordBitmap(in_x, in_y, in_bitmap, in_palette, in_hflip, in_vflip, in_hwrap, in_vwrap)) return;
+	g_mdata = RGSBlendTable();
+	RGSDrawBitmapSpans(in_x, in_y, in_bitmap, in_palette, in_hflip, in_vflip, in_hwrap, in_vwrap, 0, g_sheight);
+};
+
+
+void RGSFillSpan(int in_x, int in_y, int in_width, uint8_t in_index) { RGSFillRect(in_x, in_y, in_width, 1, in_index); };
+
+void RGSFillRect(int in_x, int in_y, int in_width, int in_height, uint8_t in_index) {
+	if (!g_rendering || in_width <= 0 || in_height <= 0 || in_x >= g_swidth || in_y >= g_sheight || (int64_t)(in_x) + in_width <= 0 || (int64_t)(in_y) + in_height <= 0) return;
+	RGSDrawCommand draw_command;
+	draw_command.type = RGS_DRAW_COMMAND_TYPE_RECT;
+	draw_command.patterns = RGS_NULL;
+	draw_command.blend = RGS_NULL;
+	draw_command.rect.x = in_x;
+	draw_command.rect.y = in_y;
+	draw_command.rect.width = in_width;
+	draw_command.rect.height = in_height;
+	draw_command.rect.index = in_index;
+	if ((g_deferred || g_bcount > 1) && in_x <= 0 && in_y <= 0 && (int64_t)(in_x) + in_width >= g_swidth && (int64_t)(in_y) + in_height >= g_sheight) RGSSkipCommands();
+	if (RGSRecordShape(&draw_command)) return;
+	RGSFillRectangle(in_x, in_y, in_width, in_height, in_index, 0, g_sheight);
+};
+
+void RGSDrawRect(int in_x, int in_y, int in_width, int in_height, uint8_t in_index) {
+	if (in_width <= 2 || in_height <= 2) {
+		RGSFillRect(in_x, in_y, in_width, in_height, in_index);
+		return;
+	};
+	RGSFillRect(in_x, in_y, in_width, 1, in_index);
+	RGSFillRect(in_x, in_y + 1, 1, in_height - 2, in_index);
+	RGSFillRect((in_x + in_width) - 1, in_y + 1, 1, in_height - 2, in_index);
+	RGSFillRect(in_x, (in_y + in_height) - 1, in_width, 1, in_index);
+};
+
+void RGSDrawLine(int in_start_x, int in_start_y, int in_end_x, int in_end_y, uint8_t in_index) {
+	if (!g_rendering) return;
+	RGSDrawCommand draw_command;
+	draw_command.type = RGS_DRAW_COMMAND_TYPE_LINE;
+	draw_command.patterns = RGS_NULL;
+	draw_command.blend = RGS_NULL;
+	draw_command.line.start_x = in_start_x;
+	draw_command.line.start_y = in_start_y;
+	draw_command.line.end_x = in_end_x;
+	draw_command.line.end_y = in_end_y;
+	draw_command.line.index = in_index;
+	if (RGSRecordShape(&draw_command)) return;
+	RGSDrawLineSpans(in_start_x, in_start_y, in_end_x, in_end_y, in_index, 0, g_sheight);
+};
+
+void RGSFillCircle(int in_x, int in_y, int in_radius, uint8_t in_index) {
+	if (!g_rendering || in_radius < 0) return;
+	RGSDrawCommand draw_command;
+	draw_command.type = RGS_DRAW_COMMAND_TYPE_CIRCLE;
+	draw_command.patterns = RGS_NULL;
+	draw_command.blend = RGS_NULL;
+	draw_command.circle.x = in_x;
+	draw_command.circle.y = in_y;
+	draw_command.circle.radius = in_radius;
+	draw_command.circle.index = in_index;
+	if (RGSRecordShape(&draw_command)) return;
+	RGSFillCircleSpans(in_x, in_y, in_radius, in_index, 0, g_sheight);
+};
+
+
+void RGSReadDrawStats(RGSDrawStats* out_stats) {
+	if (!g_rendering || !out_stats) return;
+	*out_stats = g_cstats;
 };
 
@@ -45,5 +45,26 @@ extern bool RGSGraphicsThreaded();
 extern bool RGSGraphicsRunning();
 
 
+/// @brief Reads patterns straight from the given memory when its layout matches, otherwise writes them
+/// @param inout_data 
+/// @param in_count 
+/// @param in_bits 
+/// @param in_width 
+/// @param in_height 
+/// @return Successfully used?
+extern bool RGSBindPatterns(uint8_t* inout_data, uint32_t in_count, uint32_t in_bits, uint32_t in_width, uint32_t in_height);
+
+/// @brief Copies patterns out of the given memory if they are read from it, so it can be released
+/// @param in_data 
+/// @return Successfully unbound? (Fails outside of beginning, updating and ending while graphics are prepared)
+extern bool RGSUnbindPatterns(const uint8_t* in_data);
+
+/// @brief Releases the given data once no recorded drawing can still read it
+/// @param in_release 
+/// @param inout_data 
+/// @return Successfully released or queued?
+extern bool RGSDeferRelease(void (*in_release)(void*), void* inout_data);
+
+
 #endif
 
@@ -6,11 +6,21 @@
 
 #if RGS_OS == RGS_OS_WINDOWS
 #include <combaseapi.h>
+#elif RGS_OS == RGS_OS_LINUX
+#include <stdio.h>
+#include <unistd.h>
 #endif
 
 
 #define RGS_LOG_CAPACITY 1024U
 
+#if RGS_OS == RGS_OS_LINUX
+#define RGS_LOG_RED "\x1B[91m"
+#define RGS_LOG_YELLOW "\x1B[93m"
+#define RGS_LOG_GREEN "\x1B[92m"
+#define RGS_LOG_RESET "\x1B[0m"
+#endif
+
 
 /// Internal Output Variables
 
@@ -23,6 +33,9 @@ static HANDLE g_file = NULL;
 static HANDLE g_console = NULL;
 #endif
 bool g_initialised = false;
+#elif RGS_OS == RGS_OS_LINUX
+static FILE* g_file = NULL;
+static bool g_coloured = false;
 #endif
 
 
@@ -31,6 +44,8 @@ bool g_initialised = false;
 static void RGSLog(
 #if RGS_OS == RGS_OS_WINDOWS
 	WORD in_attributes,
+#elif RGS_OS == RGS_OS_LINUX
+	const char* in_colour,
 #endif
 	const char* in_type, const char* in_sender, const char* in_message, bool in_unsafe
 ) {
@@ -64,6 +79,17 @@ static void RGSLog(
 	if (!g_file) g_file = CreateFileA("./Log.txt", GENERIC_WRITE, 0U, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
 	if (g_file) WriteFile(g_file, log_content, (DWORD)(log_size), NULL, NULL);
 	if (in_unsafe) g_safe = false;
+#elif RGS_OS == RGS_OS_LINUX
+	if (g_coloured) fputs(in_colour, stdout);
+	fwrite(log_content, sizeof(*log_content), log_size, stdout);
+	if (g_coloured) fputs(RGS_LOG_RESET, stdout);
+	fflush(stdout);
+	if (!g_file) g_file = fopen("./Log.txt", "w");
+	if (g_file) {
+		fwrite(log_content, sizeof(*log_content), log_size, g_file);
+		fflush(g_file);
+	};
+	if (in_unsafe) g_safe = false;
 #endif
 	if (g_lock != RGS_LOCK_INVALID) RGSDeactivateLock(RGS_LOCK_PASS(g_lock));
 };
@@ -85,10 +111,18 @@ bool RGSPrepareOutput() {
 		return false;
 	};
 	g_initialised = true;
+#elif RGS_OS == RGS_OS_LINUX
+	g_coloured = isatty(fileno(stdout)) != 0;
 #endif
 	g_lock = RGSCreateLock(false);
 	if (g_lock == RGS_LOCK_INVALID) {
-		RGSLog(FOREGROUND_RED | FOREGROUND_INTENSITY, "--Fatal Error", "Output", "Failed to create lock", true);
+		RGSLog(
+#if RGS_OS == RGS_OS_WINDOWS
+			FOREGROUND_RED | FOREGROUND_INTENSITY,
+#elif RGS_OS == RGS_OS_LINUX
+			RGS_LOG_RED,
+#endif
+			"--Fatal Error", "Output", "Failed to create lock", true);
 		RGSReleaseOutput();
 		return false;
 	};
@@ -101,6 +135,9 @@ void RGSReleaseOutput() {
 #if RGS_OS == RGS_OS_WINDOWS
 	if (g_file) CloseHandle(g_file);
 	if (g_initialised) CoUninitialize();
+#elif RGS_OS == RGS_OS_LINUX
+	if (g_file) fclose(g_file);
+	g_file = NULL;
 #endif
 	if (g_lock != RGS_LOCK_INVALID) RGSDestroyLock(RGS_LOCK_PASS(g_lock));
 };
@@ -109,12 +146,25 @@ void RGSReleaseOutput() {
 bool RGSSafe() { return g_safe; };
 
 
+void RGSReportInfo(const char* in_sender, const char* in_message) {
+	RGSLog(
+#if RGS_OS == RGS_OS_WINDOWS
+		FOREGROUND_GREEN | FOREGROUND_INTENSITY,
+#elif RGS_OS == RGS_OS_LINUX
+		RGS_LOG_GREEN,
+#endif
+		"--Info", in_sender, in_message && *in_message ? in_message : "No information has been reported", false);
+};
+
+
 /// Exposed Output Functions
 
 void RGSReportWarning(const char* in_sender, const char* in_message) {
 	RGSLog(
 #if RGS_OS == RGS_OS_WINDOWS
 		FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_INTENSITY,
+#elif RGS_OS == RGS_OS_LINUX
+		RGS_LOG_YELLOW,
 #endif
 		"--Warning", in_sender, in_message && *in_message ?in_message : "An unknown warning has been reported", false);
 };
@@ -123,6 +173,8 @@ void RGSReportError(const char* const in_sender, const char* in_message, bool in
 	RGSLog(
 #if RGS_OS == RGS_OS_WINDOWS
 		FOREGROUND_RED | FOREGROUND_INTENSITY,
+#elif RGS_OS == RGS_OS_LINUX
+		RGS_LOG_RED,
 #endif
 		in_fatal ? "--Fatal Error" : "--Error", in_sender, in_message && *in_message ? in_message : "An unknown error has been reported", in_fatal);
 };
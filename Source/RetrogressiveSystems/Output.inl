@@ -19,5 +19,11 @@ extern void RGSReleaseOutput();
 extern bool RGSSafe();
 
 
+/// @brief Sends the given information to the logger
+/// @param in_sender 
+/// @param in_message 
+extern void RGSReportInfo(const char* in_sender, const char* in_message);
+
+
 #endif
 
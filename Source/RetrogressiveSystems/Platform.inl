@@ -10,6 +10,30 @@
 #define NOMINMAX
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
+#elif RGS_OS == RGS_OS_LINUX
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+#endif
+
+
+#if RGS_ARCH == RGS_ARCH_X64
+#if RGS_OS == RGS_OS_WINDOWS
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+
+#if RGS_OS == RGS_OS_WINDOWS
+#define RGS_INLINE __forceinline
+#define RGS_TARGET(_TARGET)
+#define RGS_THREAD_LOCAL __declspec(thread)
+#else
+#define RGS_INLINE inline __attribute__((always_inline))
+#define RGS_TARGET(_TARGET) __attribute__((target(_TARGET)))
+#define RGS_THREAD_LOCAL _Thread_local
 #endif
 
 
@@ -1,6 +1,11 @@
 #include "./Threads.inl"
 
 
+#include <RetrogressiveSystems/Types.h>
+
+#include <stdlib.h>
+
+
 /// Internal Thread Types
 
 typedef struct RGSThreadLaunchParameters {
@@ -8,6 +13,21 @@ typedef struct RGSThreadLaunchParameters {
 	void* parameters;
 } RGSThreadLaunchParameters;
 
+#if RGS_OS == RGS_OS_LINUX
+struct RGSThreadObject {
+	pthread_t handle;
+	bool joined;
+};
+#endif
+
+
+/// Internal Thread Variables
+
+#if RGS_OS == RGS_OS_LINUX
+static pthread_mutex_t g_cmutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_ccondition = PTHREAD_COND_INITIALIZER;
+#endif
+
 
 /// Internal Thread Functions
 
@@ -17,12 +37,58 @@ void RGSActivateLock(RGSLockParameter in_lock) {
 		InterlockedDecrement(in_lock);
 		Sleep(0UL);
 	};
+#elif RGS_OS == RGS_OS_LINUX
+	while (atomic_fetch_add(in_lock, 1L) > 0L) {
+		atomic_fetch_sub(in_lock, 1L);
+		sched_yield();
+	};
 #endif
 };
 
 void RGSDeactivateLock(RGSLockParameter in_lock) {
 #if RGS_OS == RGS_OS_WINDOWS
 	InterlockedDecrement(in_lock);
+#elif RGS_OS == RGS_OS_LINUX
+	atomic_fetch_sub(in_lock, 1L);
+#endif
+};
+
+
+long RGSAddToCounter(RGSCounterParameter inout_counter, long in_value) {
+#if RGS_OS == RGS_OS_WINDOWS
+	return (long)(InterlockedAdd(inout_counter, (LONG)(in_value)));
+#elif RGS_OS == RGS_OS_LINUX
+	return atomic_fetch_add(inout_counter, in_value) + in_value;
+#endif
+};
+
+long RGSReadCounter(RGSCounterParameter in_counter) {
+#if RGS_OS == RGS_OS_WINDOWS
+	return (long)(InterlockedCompareExchange(in_counter, 0L, 0L));
+#elif RGS_OS == RGS_OS_LINUX
+	return atomic_load(in_counter);
+#endif
+};
+
+void RGSWaitForCounter(RGSCounterParameter in_counter, long in_value) {
+#if RGS_OS == RGS_OS_WINDOWS
+	LONG compare_value = (LONG)(in_value);
+	WaitOnAddress((volatile VOID*)(in_counter), (PVOID)(&compare_value), sizeof(compare_value), INFINITE);
+#elif RGS_OS == RGS_OS_LINUX
+	pthread_mutex_lock(&g_cmutex);
+	while (atomic_load(in_counter) == in_value) pthread_cond_wait(&g_ccondition, &g_cmutex);
+	pthread_mutex_unlock(&g_cmutex);
+#endif
+};
+
+void RGSWakeCounterWaiters(RGSCounterParameter in_counter) {
+#if RGS_OS == RGS_OS_WINDOWS
+	WakeByAddressAll((PVOID)(in_counter));
+#elif RGS_OS == RGS_OS_LINUX
+	(void)(in_counter);
+	pthread_mutex_lock(&g_cmutex);
+	pthread_mutex_unlock(&g_cmutex);
+	pthread_cond_broadcast(&g_ccondition);
 #endif
 };
 
@@ -33,6 +99,12 @@ static DWORD WINAPI RGSThreadJobRunner(LPVOID inout_parameters) {
 	launch_parameters->job(launch_parameters->parameters);
 	return 0UL;
 };
+#elif RGS_OS == RGS_OS_LINUX
+static void* RGSThreadJobRunner(void* inout_parameters) {
+	RGSThreadLaunchParameters* launch_parameters = (RGSThreadLaunchParameters*)(inout_parameters);
+	launch_parameters->job(launch_parameters->parameters);
+	return NULL;
+};
 #endif
 
 RGSThread RGSCreateThread(RGSThreadJob in_job, RGSLockParameter inout_lock, void* inout_parameters) {
@@ -44,6 +116,16 @@ RGSThread RGSCreateThread(RGSThreadJob in_job, RGSLockParameter inout_lock, void
 		Sleep(0UL);
 	};
 	InterlockedDecrement(inout_lock);
+#elif RGS_OS == RGS_OS_LINUX
+	RGSThread launched_thread = (RGSThread)(malloc(sizeof(*launched_thread)));
+	if (!launched_thread) return RGS_THREAD_INVALID;
+	launched_thread->joined = false;
+	if (pthread_create(&launched_thread->handle, NULL, &RGSThreadJobRunner, (void*)(&launch_parameters))) {
+		free(launched_thread);
+		return RGS_THREAD_INVALID;
+	};
+	RGSActivateLock(inout_lock);
+	RGSDeactivateLock(inout_lock);
 #endif
 	return launched_thread;
 };
@@ -51,6 +133,10 @@ RGSThread RGSCreateThread(RGSThreadJob in_job, RGSLockParameter inout_lock, void
 void RGSDestroyThread(RGSThreadParameter in_thread) {
 #if RGS_OS == RGS_OS_WINDOWS
 	CloseHandle(in_thread);
+#elif RGS_OS == RGS_OS_LINUX
+	if (!in_thread) return;
+	if (!in_thread->joined) pthread_detach(in_thread->handle);
+	free(in_thread);
 #endif
 };
 
@@ -58,6 +144,17 @@ void RGSDestroyThread(RGSThreadParameter in_thread) {
 void RGSWaitForThread(RGSThreadParameter in_thread) {
 #if RGS_OS == RGS_OS_WINDOWS
 	WaitForSingleObject(in_thread, INFINITE);
+#elif RGS_OS == RGS_OS_LINUX
+	if (!in_thread || in_thread->joined) return;
+	pthread_join(in_thread->handle, NULL);
+	in_thread->joined = true;
 #endif
 };
 
+void RGSYieldThread() {
+#if RGS_OS == RGS_OS_WINDOWS
+	Sleep(0UL);
+#elif RGS_OS == RGS_OS_LINUX
+	sched_yield();
+#endif
+};
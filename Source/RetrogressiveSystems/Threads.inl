@@ -13,18 +13,36 @@
 
 #define RGSLock volatile LONG																								// Lock Type
 #define RGSLockParameter RGSLock*																							// Lock Parameter Type
+#define RGSCounter volatile LONG																							// Counter Type
+#define RGSCounterParameter RGSCounter*																						// Counter Parameter Type
 typedef HANDLE RGSThread;																									// Thread Type
 typedef RGSThread RGSThreadParameter;																						// Thread Parameter Type
+#elif RGS_OS == RGS_OS_LINUX
+#define RGS_LOCK_INVALID															-1L										// Invalid Lock Value
+#define RGS_THREAD_INVALID															NULL									// Invalid Thread Value
+
+
+#define RGSLock atomic_long																									// Lock Type
+#define RGSLockParameter RGSLock*																							// Lock Parameter Type
+#define RGSCounter atomic_long																								// Counter Type
+#define RGSCounterParameter RGSCounter*																						// Counter Parameter Type
+typedef struct RGSThreadObject* RGSThread;																					// Thread Type
+typedef RGSThread RGSThreadParameter;																						// Thread Parameter Type
 #endif
 
 typedef void(*RGSThreadJob)(void*);																							// Thread Job Type
 
-#if RGS_OS == RGS_OS_WINDOWS
+#if RGS_OS == RGS_OS_WINDOWS || RGS_OS == RGS_OS_LINUX
 /// @brief Passes the given lock to a function
 /// @param _LOCK
 /// @return Lock parameter
 #define RGS_LOCK_PASS(_LOCK) (&_LOCK)
 
+/// @brief Passes the given counter to a function
+/// @param _COUNTER
+/// @return Counter parameter
+#define RGS_COUNTER_PASS(_COUNTER) (&_COUNTER)
+
 /// @brief Passes the given thread to a function
 /// @param 
 #define RGS_THREAD_PASS(_THREAD) (_THREAD)
@@ -33,10 +51,23 @@ typedef void(*RGSThreadJob)(void*);																							// Thread Job Type
 /// @brief Creates a new lock object with the specified starting state
 /// @param _LOCKED
 /// @return Lock object
+#if RGS_OS == RGS_OS_WINDOWS
 #define RGSCreateLock(_LOCKED) ((LONG)(_LOCKED))
+#else
+#define RGSCreateLock(_LOCKED) ((long)(_LOCKED))
+#endif
 
 /// @brief Destroys the given lock object
 #define RGSDestroyLock(_LOCK)
+
+/// @brief Creates a new counter object with the specified starting value
+/// @param _VALUE
+/// @return Counter object
+#if RGS_OS == RGS_OS_WINDOWS
+#define RGSCreateCounter(_VALUE) ((LONG)(_VALUE))
+#else
+#define RGSCreateCounter(_VALUE) ((long)(_VALUE))
+#endif
 #endif
 
 
@@ -49,6 +80,27 @@ extern void RGSActivateLock(RGSLockParameter in_lock);
 extern void RGSDeactivateLock(RGSLockParameter in_lock);
 
 
+/// @brief Adds the given value to a counter so every thread sees the change
+/// @param inout_counter 
+/// @param in_value 
+/// @return New counter value
+extern long RGSAddToCounter(RGSCounterParameter inout_counter, long in_value);
+
+/// @brief Reads the given counter's current value
+/// @param in_counter 
+/// @return Counter value
+extern long RGSReadCounter(RGSCounterParameter in_counter);
+
+/// @brief Blocks the calling thread until the given counter no longer holds the specified value (May return early, so check the counter again)
+/// @param in_counter 
+/// @param in_value 
+extern void RGSWaitForCounter(RGSCounterParameter in_counter, long in_value);
+
+/// @brief Wakes every thread waiting for the given counter to change
+/// @param in_counter 
+extern void RGSWakeCounterWaiters(RGSCounterParameter in_counter);
+
+
 /// @brief Creates a new thread with the given job and parameters
 /// @param in_job 
 /// @param inout_lock 
@@ -65,6 +117,9 @@ extern void RGSDestroyThread(RGSThreadParameter in_thread);
 /// @param in_thread 
 extern void RGSWaitForThread(RGSThreadParameter in_thread);
 
+/// @brief Gives the rest of the calling thread's time slice to other threads
+extern void RGSYieldThread();
+
 
 #endif
 
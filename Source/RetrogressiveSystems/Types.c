@@ -18,6 +18,10 @@ RGSTime RGSTimeNow() {
 	LARGE_INTEGER time_counter;
 	if (!QueryPerformanceCounter(&time_counter)) return UINT64_C(0);
 	return (RGSTime)(((double)(time_counter.QuadPart) / frequency_value) * (double)(RGS_ONE_SECOND));
+#elif RGS_OS == RGS_OS_LINUX
+	struct timespec time_counter;
+	if (clock_gettime(CLOCK_MONOTONIC, &time_counter)) return UINT64_C(0);
+	return ((RGSTime)(time_counter.tv_sec) * (RGSTime)(RGS_ONE_SECOND)) + ((RGSTime)(time_counter.tv_nsec) / UINT64_C(1000));
 #endif
 };
 